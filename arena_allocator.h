@@ -0,0 +1,67 @@
+//
+// Pooled protobuf arenas for the messages of gRPC callback methods.
+//
+
+#ifndef AUTORECOVERER_ARENA_ALLOCATOR_H
+#define AUTORECOVERER_ARENA_ALLOCATOR_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <grpcpp/support/message_allocator.h>
+#include <google/protobuf/arena.h>
+
+//Messages of the callback methods live on protobuf arenas. An arena starts on a block of
+//its own and is reset and pooled when its call is done, so after warming up a call
+//allocates its messages from memory that was already there.
+template <class Req, class Resp>
+class ArenaAllocator:public grpc::MessageAllocator<Req, Resp>{
+    struct Holder:public grpc::MessageHolder<Req, Resp>{
+        ArenaAllocator *owner;
+        std::unique_ptr<char[]> block;
+        google::protobuf::Arena arena;
+
+        Holder(ArenaAllocator *owner, size_t blockSize):
+            owner(owner), block(new char[blockSize]), arena(block.get(), blockSize) {}
+        void create() {
+            this->set_request(google::protobuf::Arena::CreateMessage<Req>(&arena));
+            this->set_response(google::protobuf::Arena::CreateMessage<Resp>(&arena));
+        }
+        void Release() override {
+            arena.Reset();
+            owner->put(this);
+        }
+    };
+    size_t blockSize;
+    std::mutex poolMutex;
+    std::vector<Holder*> pool;
+    static const size_t maxPooled=16;
+
+    void put(Holder *h) {
+        std::lock_guard<std::mutex> lk(poolMutex);
+        if (pool.size()<maxPooled) pool.push_back(h);
+        else delete h;
+    }
+
+public:
+    explicit ArenaAllocator(size_t blockSize): blockSize(blockSize) {}
+    ~ArenaAllocator() override {
+        for (Holder *h:pool) delete h;
+    }
+
+    grpc::MessageHolder<Req, Resp>* AllocateMessages() override {
+        Holder *h=nullptr;
+        {
+            std::lock_guard<std::mutex> lk(poolMutex);
+            if (!pool.empty()) {
+                h=pool.back();
+                pool.pop_back();
+            }
+        }
+        if (h==nullptr) h=new Holder(this, blockSize);
+        h->create();
+        return h;
+    }
+};
+
+#endif //AUTORECOVERER_ARENA_ALLOCATOR_H
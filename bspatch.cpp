@@ -0,0 +1,174 @@
+//
+// Applies bsdiff patches (BSDIFF40) onto a clone of the old file, writing only what differs.
+//
+
+#include "bspatch.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <bzlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+
+namespace {
+
+const int64_t blockSize=1024*1024;
+const int64_t pageSize=4096;
+
+//bsdiff's sign and magnitude, little endian
+int64_t offtin(const unsigned char *buf) {
+    int64_t y=buf[7]&0x7f;
+    for (int i=6; i>=0; i--) y=y*256+buf[i];
+    return (buf[7]&0x80)?-y:y;
+}
+
+//One of the three bzip2 streams of a patch: control, diff and extra.
+class Stream {
+public:
+    ~Stream() {
+        int err;
+        if (bz!=nullptr) BZ2_bzReadClose(&err, bz);
+        if (f!=nullptr) fclose(f);
+    }
+
+    bool open(const char *path, int64_t offset) {
+        int err;
+        f=fopen(path, "rb");
+        if (f==nullptr || fseeko(f, offset, SEEK_SET)!=0) return false;
+        bz=BZ2_bzReadOpen(&err, f, 0, 0, nullptr, 0);
+        return err==BZ_OK;
+    }
+
+    bool read(void *buf, int64_t n) {
+        int err;
+        int got=n>0?BZ2_bzRead(&err, bz, buf, (int)n):0;
+        return got==n && (n==0 || err==BZ_OK || err==BZ_STREAM_END);
+    }
+
+private:
+    FILE *f=nullptr;
+    BZFILE *bz=nullptr;
+};
+
+bool writeAll(int fd, const char *data, int64_t n, int64_t offset) {
+    while (n>0) {
+        ssize_t put=pwrite(fd, data, n, offset);
+        if (put<0 && errno==EINTR) continue;
+        if (put<=0) return false;
+        data+=put;
+        offset+=put;
+        n-=put;
+    }
+    return true;
+}
+
+bool zero(const char *data, int64_t n) {
+    static const char zeros[pageSize]={};
+    for (; n>0; data+=pageSize, n-=pageSize)
+        if (memcmp(data, zeros, std::min(n, pageSize))!=0) return false;
+    return true;
+}
+
+//Copies size bytes of in to out, by reference where the filesystem can; returns how, or
+//nullptr on failure.
+const char *cloneFile(int in, int out, int64_t size) {
+    if (ioctl(out, FICLONE, in)==0) return "reflink";
+    loff_t from=0, to=0;
+    while (from<size) {
+        ssize_t n=copy_file_range(in, &from, out, &to, size-from, 0);
+        if (n<=0) break;
+    }
+    if (from==size) return "copy_file_range";
+    //Not supported across these files; go on from where it stopped
+    std::vector<char> buffer(blockSize);
+    while (from<size) {
+        ssize_t n=pread(in, buffer.data(), std::min(blockSize, size-from), from);
+        if (n<0 && errno==EINTR) continue;
+        if (n<=0 || !writeAll(out, buffer.data(), n, from)) return nullptr;
+        from+=n;
+    }
+    return "read/write";
+}
+
+}
+
+bool patchFile(const char *oldFile, const char *newFile, const char *patch, PatchStats &stats) {
+    unsigned char header[32];
+    FILE *p=fopen(patch, "rb");
+    if (p==nullptr) return false;
+    bool ok=fread(header, 1, 32, p)==32 && memcmp(header, "BSDIFF40", 8)==0;
+    fclose(p);
+    int64_t ctrlLen=offtin(header+8), diffLen=offtin(header+16), newSize=offtin(header+24);
+    if (!ok || ctrlLen<0 || diffLen<0 || newSize<0) return false;
+    Stream ctrl, diff, extra;
+    if (!ctrl.open(patch, 32) || !diff.open(patch, 32+ctrlLen) || !extra.open(patch, 32+ctrlLen+diffLen)) return false;
+
+    int oldFd=open(oldFile, O_RDONLY);
+    if (oldFd<0) return false;
+    struct stat st;
+    int newFd=fstat(oldFd, &st)==0?open(newFile, O_RDWR|O_CREAT|O_TRUNC, 0644):-1;
+    if (newFd<0) {
+        close(oldFd);
+        return false;
+    }
+    int64_t oldSize=st.st_size;
+    stats.size=newSize;
+    stats.written=0;
+    stats.clone=cloneFile(oldFd, newFd, oldSize);
+    ok=stats.clone!=nullptr;
+
+    std::vector<char> delta(blockSize), old(blockSize);
+    //New bytes [at, at+n) of the block at newPos are old bytes at oldPos plus the delta
+    auto writeRun=[&](int64_t newPos, int64_t oldPos, int64_t at, int64_t n) {
+        int64_t lo=std::max(oldPos+at, (int64_t)0), hi=std::min(oldPos+at+n, oldSize);
+        if (lo<hi && pread(oldFd, old.data(), hi-lo, lo)!=hi-lo) return false;
+        for (int64_t i=lo; i<hi; i++) delta[i-oldPos]+=old[i-lo];
+        stats.written+=n;
+        return writeAll(newFd, delta.data()+at, n, newPos+at);
+    };
+    int64_t oldPos=0, newPos=0;
+    unsigned char triple[24];
+    while (ok && newPos<newSize) {
+        //Add x bytes of diff onto old, copy y bytes of extra, then move in old by z
+        ok=ctrl.read(triple, 24);
+        int64_t x=offtin(triple), y=offtin(triple+8), z=offtin(triple+16);
+        ok=ok && x>=0 && y>=0 && newPos+x<=newSize;
+        for (int64_t done=0; ok && done<x; done+=blockSize) {
+            int64_t n=std::min(blockSize, x-done);
+            ok=diff.read(delta.data(), n);
+            if (!ok) break;
+            int64_t from=oldPos+done, to=newPos+done;
+            //Where nothing moved, the clone already holds every page the delta leaves alone
+            if (from!=to || from+n>oldSize) {
+                ok=writeRun(to, from, 0, n);
+                continue;
+            }
+            for (int64_t at=0; ok && at<n; ) {
+                int64_t end=at;
+                while (end<n && !zero(delta.data()+end, std::min(pageSize, n-end))) end+=pageSize;
+                end=std::min(end, n);
+                if (end>at) ok=writeRun(to, from, at, end-at);
+                at=end+pageSize;
+            }
+        }
+        newPos+=x;
+        oldPos+=x;
+        ok=ok && newPos+y<=newSize;
+        for (int64_t done=0; ok && done<y; done+=blockSize) {
+            int64_t n=std::min(blockSize, y-done);
+            ok=extra.read(delta.data(), n) && writeAll(newFd, delta.data(), n, newPos+done);
+            stats.written+=n;
+        }
+        newPos+=y;
+        oldPos+=z;
+    }
+    ok=ok && ftruncate(newFd, newSize)==0;
+    close(oldFd);
+    ok=close(newFd)==0 && ok;
+    return ok;
+}
@@ -0,0 +1,22 @@
+//
+// Applies bsdiff patches (BSDIFF40) onto a clone of the old file, writing only what differs.
+//
+
+#ifndef AUTORECOVERER_BSPATCH_H
+#define AUTORECOVERER_BSPATCH_H
+
+#include <cstdint>
+
+struct PatchStats {
+    const char *clone="";       //How the old file was copied: reflink, copy_file_range or read/write
+    int64_t size=0;             //Of the new file
+    int64_t written=0;          //Bytes written over the clone
+};
+
+//Builds newFile from oldFile and patch as bspatch does. newFile starts as a clone of oldFile,
+//sharing its blocks where the filesystem can, and only the pages the patch changes, and the
+//regions it moves or inserts, are written. Returns false if the patch is malformed or I/O
+//failed, leaving newFile incomplete.
+bool patchFile(const char *oldFile, const char *newFile, const char *patch, PatchStats &stats);
+
+#endif //AUTORECOVERER_BSPATCH_H
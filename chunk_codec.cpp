@@ -0,0 +1,28 @@
+//
+// Checksums and compresses chunks for the wire in one pass over their bytes.
+//
+
+#include "chunk_codec.h"
+#include <algorithm>
+
+int64_t hashCompress(z_stream &zs, const char *data, int64_t len, bool hash, bool compress, std::vector<char> &out,
+                     uint32_t &checksum) {
+    checksum=crc32(0L, Z_NULL, 0);
+    if (compress) {
+        out.resize(deflateBound(&zs, len));
+        deflateReset(&zs);
+        zs.next_out=(Bytef*)out.data();
+        zs.avail_out=out.size();
+    }
+    for (int64_t off=0; off<len; off+=codecBlock) {
+        int64_t n=std::min(codecBlock, len-off);
+        if (hash) checksum=crc32(checksum, (const Bytef*)data+off, n);
+        if (compress) {
+            zs.next_in=(Bytef*)data+off;
+            zs.avail_in=n;
+            if (deflate(&zs, off+n==len?Z_FINISH:Z_NO_FLUSH)==Z_STREAM_ERROR) return -1;
+        }
+    }
+    if (!compress || (int64_t)zs.total_out>=len) return -1;
+    return zs.total_out;
+}
@@ -0,0 +1,22 @@
+//
+// Checksums and compresses chunks for the wire in one pass over their bytes.
+//
+
+#ifndef AUTORECOVERER_CHUNK_CODEC_H
+#define AUTORECOVERER_CHUNK_CODEC_H
+
+#include <cstdint>
+#include <vector>
+#include <zlib.h>
+
+//Bytes of a chunk that go through crc32 and then deflate while they are still in cache
+const int64_t codecBlock=32*1024;
+
+//Takes the crc32 of a chunk into checksum if hash is set, and deflates it into out on zs
+//(set up by deflateInit2 for raw deflate) if compress is set, block by block in one pass.
+//Returns the compressed length, or -1 when the chunk is not compressed or does not shrink
+//and should be sent as it is.
+int64_t hashCompress(z_stream &zs, const char *data, int64_t len, bool hash, bool compress, std::vector<char> &out,
+                     uint32_t &checksum);
+
+#endif //AUTORECOVERER_CHUNK_CODEC_H
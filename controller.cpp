@@ -6,12 +6,35 @@
 #include <cstdlib>
 #include <string>
 #include <cstring>
+#include <chrono>
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <ctime>
+#include <csignal>
+#include <type_traits>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <ftw.h>
+#include <unistd.h>
+#include <fcntl.h>
 
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/support/status.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <google/protobuf/arena.h>
+#include <zlib.h>
 #include "recover_service.grpc.pb.h"
 #include "recover_service.pb.h"
+#include "launcher.h"
+#include "docker_client.h"
+#include "chunk_codec.h"
 
 using grpc::Channel;
 using grpc::ClientContext;
@@ -23,231 +46,1091 @@ using grpc::Status;
 using namespace recoverer;
 
 std::string containerID, imageName, recoverAddr;
+DockerClient docker;
 
-void executeCMD(const char *cmd)
-{
-    std::cerr<<cmd<<std::endl;
-    char* buf_ps=new char[1024];
-    char* result=new char[65536];
-    buf_ps[0]=0;
-    result[0]=0;
-    char ps[1024]={0};
-    FILE *ptr;
-    strcpy(ps, cmd);
-    if((ptr=popen(ps, "r"))!=NULL)
-    {
-        while(fgets(buf_ps, 1024, ptr)!=NULL)
+//Chunk size is picked per transfer (see pickChunkSize) unless fixed in the config.
+//The recoverer accepts messages up to its own maxChunkSize plus some headroom.
+const int64_t defaultChunkSize=1024*1024;
+const int64_t minChunkSize=64*1024;
+const int64_t maxChunkSize=16*1024*1024;
+int64_t fixedChunkSize=0;          //0 means auto
+int64_t inlineLimit=512*1024;      //Versions up to this size go in a single PushVersion
+
+//Diffs kept on disk for recoverers that fell behind: (version, size), oldest first.
+//diff<v> always applies to version v-1.
+std::deque<std::pair<int, int64_t>> diffHistory;
+int historyDepth=8;
+//A cumulative diff is only computed (bsdiff of two whole images) when the cheapest other
+//route would send more than this
+int64_t cumulativeMin=16*1024*1024;
+int diffTimeoutMs=0;                //bsdiff runs longer than this are killed, 0 for no limit
+
+//How each version is captured:
+//  save      docker save of the committed image, diffed against the previous one by bsdiff
+//  upperdir  a full save only to start a chain (the first version, or when the recoverer
+//            cannot be brought up to date otherwise); every later version is a change set
+//            of the container's overlay upperdir: a tar of the entries changed since the
+//            previous capture, then the paths removed since (see protocolDraft.txt).
+//            Only changed files are read. Needs overlay2 and docker's storage on this host.
+enum CaptureMode {CAPTURE_SAVE=0, CAPTURE_UPPERDIR};
+CaptureMode captureMode=CAPTURE_SAVE;
+int chainBase=-1;                   //Full version the change sets build on, -1 for none
+//Least time between the starts of two captures. A change set with nothing in it is not a
+//version; it is tried again after the interval.
+int64_t captureInterval=1000;       //ms
+
+bool isChangeset(int version) {
+    return captureMode==CAPTURE_UPPERDIR && chainBase>=0 && version>chainBase;
+}
+
+//Measurements of the previous transfer, used to tune the next one
+double lastThroughput=0;           //Bytes per second
+double lastResendRatio=0;          //Resent chunks / chunks
+
+//Chunks bypass the generated stub: each request is a Chunk encoded by hand as two
+//slices, the fields and the payload, and the payload slice points into the mapped file,
+//so its bytes are never copied before gRPC writes them out.
+grpc::GenericStub *rawStub;
+grpc::CompletionQueue *rawCQ;
+
+char* putVarint(char *p, uint64_t v) {
+    while (v>=0x80) {
+        *p++=(char)(v|0x80);
+        v>>=7;
+    }
+    *p++=(char)v;
+    return p;
+}
+
+//Keys of the Chunk fields, taken from the generated field numbers. The wire types follow
+//from the field types, pinned down here too, so a change to recover_service.proto
+//either still encodes right or does not compile.
+constexpr char fieldKey(int number, int wireType) {
+    return (char)(number<<3|wireType);
+}
+static_assert(Chunk::kImageFieldNumber<16 && Chunk::kVersionFieldNumber<16 && Chunk::kNumberFieldNumber<16
+              && Chunk::kDataFieldNumber<16 && Chunk::kChecksumFieldNumber<16 && Chunk::kCompressedFieldNumber<16,
+              "Chunk keys are written as one byte");
+static_assert(std::is_same<decltype(std::declval<Chunk>().image()), int32_t>::value
+              && std::is_same<decltype(std::declval<Chunk>().version()), int32_t>::value
+              && std::is_same<decltype(std::declval<Chunk>().number()), int64_t>::value
+              && std::is_same<decltype(std::declval<Chunk>().checksum()), int32_t>::value
+              && std::is_same<decltype(std::declval<Chunk>().compressed()), bool>::value
+              && std::is_same<decltype(std::declval<Chunk>().data()), const std::string&>::value,
+              "Chunk fields are written as varints and data as bytes");
+
+//Writes every field of a Chunk but the bytes of data to header (64 bytes suffice) and
+//returns its end.
+char* encodeChunkHeader(char *header, int imageN, int version, int64_t number, int64_t toSend, bool compressed,
+                        bool hasChecksum, uint32_t checksum) {
+    char *end=header;
+    *end++=fieldKey(Chunk::kImageFieldNumber, 0);
+    end=putVarint(end, (uint64_t)(int64_t)imageN);
+    *end++=fieldKey(Chunk::kVersionFieldNumber, 0);
+    end=putVarint(end, (uint64_t)(int64_t)version);
+    *end++=fieldKey(Chunk::kNumberFieldNumber, 0);
+    end=putVarint(end, number);
+    if (hasChecksum) {
+        *end++=fieldKey(Chunk::kChecksumFieldNumber, 0);
+        end=putVarint(end, (uint64_t)(int64_t)(int32_t)checksum);
+    }
+    if (compressed) {
+        *end++=fieldKey(Chunk::kCompressedFieldNumber, 0);
+        *end++=1;
+    }
+    *end++=fieldKey(Chunk::kDataFieldNumber, 2);
+    return putVarint(end, toSend);
+}
+
+//Whether protobuf parses what encodeChunkHeader writes back into the same Chunk; checked
+//once at startup, since the recoverer would only see garbage chunks.
+bool chunkEncodingOK() {
+    char header[64];
+    const char data[]="data";
+    char *end=encodeChunkHeader(header, 3, 70000, 5000000000LL, 4, true, true, 0xdeadbeef);
+    Chunk ck;
+    return ck.ParseFromString(std::string(header, end)+std::string(data, 4)) && ck.image()==3 && ck.version()==70000
+           && ck.number()==5000000000LL && ck.data()=="data" && ck.checksum()==(int32_t)0xdeadbeef && ck.compressed();
+}
+
+//Sends the toSend bytes at data as chunk number: compressed (raw deflate) if so marked,
+//and with the crc32 of the uncompressed chunk if hasChecksum. Returns the status the
+//recoverer answered (8 taken, 9 refused), or 0 if the call itself failed.
+int sendChunk(int imageN, int version, int64_t number, const char *data, int64_t toSend, bool compressed,
+              bool hasChecksum, uint32_t checksum) {
+    char header[64];
+    char *end=encodeChunkHeader(header, imageN, version, number, toSend, compressed, hasChecksum, checksum);
+    grpc::Slice slices[2]={grpc::Slice(header, end-header), grpc::Slice(data, toSend, grpc::Slice::STATIC_SLICE)};
+    grpc::ByteBuffer request(slices, 2), response;
+    ClientContext cc;
+    Status st;
+    auto call=rawStub->PrepareUnaryCall(&cc, "/recoverer.recover_service/SendChunk", request, rawCQ);
+    call->StartCall();
+    call->Finish(&response, &st, nullptr);
+    void *tag;
+    bool ok=false;
+    Reply rpl;
+    if (!rawCQ->Next(&tag, &ok) || !ok || !st.ok()
+        || !grpc::SerializationTraits<Reply>::Deserialize(&response, &rpl).ok())
+        return 0;
+    return rpl.status();
+}
+
+//Chunks are prepared up to readDepth ahead of sending by a pool of readWorkers threads,
+//so the disk, the CPU and the network are busy at the same time, and are handed to the
+//sender in order through a ring of readDepth reusable slots. Preparing a chunk reads it
+//(readahead for a mapped file, pread into the slot otherwise) and, if enabled, checksums
+//and compresses it in one pass (hashCompress).
+int readDepth=4;
+int readWorkers=1;
+bool checksums=false;
+int compressLevel=0;                //0 sends chunks as they are
+
+struct Slot {
+    int64_t index=-1;               //Position in the send order of the chunk it holds
+    const char *data;
+    int64_t length;
+    bool compressed;
+    uint32_t checksum;
+    std::vector<char> in, out;      //Read chunk and compressed chunk
+};
+std::vector<Slot> ring;
+
+struct SendStats {
+    double waited=0;                //Seconds sending waited for chunks to be ready
+    int64_t wireBytes=0;            //Bytes that went on the wire
+    int64_t refused=0;              //Chunks the recoverer refused; they stay missing
+};
+
+//Sends the chunks of the file in order, adding to stats. Returns false, with the rest
+//unsent, if a SendChunk call failed or a chunk could not be read whole.
+bool sendChunks(int imageN, int version, const char *map, int fd, int64_t size, int64_t chunkSize,
+                const std::vector<int64_t> &order, SendStats &stats) {
+    size_t depth=readDepth;
+    if (ring.size()<depth) ring.resize(depth);
+    for (auto &slot:ring) slot.index=-1;
+    std::mutex m;
+    std::condition_variable cv;
+    size_t next=0, consumed=0;
+    bool stop=false;
+    int64_t unread=-1;              //Chunk a reader failed on
+    int readErrno=0;
+    std::vector<std::thread> workers;
+    for (int w=0; w<readWorkers; w++)
+        workers.emplace_back([&]() {
+            z_stream zs{};
+            if (compressLevel>0) deflateInit2(&zs, compressLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+            while (true) {
+                size_t i;
+                {
+                    std::unique_lock<std::mutex> lk(m);
+                    if (next==order.size() || stop) break;
+                    i=next++;
+                    cv.wait(lk, [&]() { return i-consumed<depth || stop; });
+                    if (stop) break;
+                }
+                Slot &slot=ring[i%depth];
+                int64_t offset=order[i]*chunkSize, len=std::min(chunkSize, size-offset);
+                const char *data=map+offset;
+                if (map!=nullptr) readahead(fd, offset, len);
+                else {
+                    slot.in.resize(chunkSize);
+                    int64_t done=0, n;
+                    while (done<len && ((n=pread(fd, &slot.in[done], len-done, offset+done))>0 || (n<0 && errno==EINTR)))
+                        done+=std::max<int64_t>(n, 0);
+                    //A chunk read short (an error, or the file shrank) must not go out
+                    if (done<len) {
+                        std::lock_guard<std::mutex> lk(m);
+                        unread=order[i];
+                        readErrno=n<0?errno:0;
+                        stop=true;
+                        cv.notify_all();
+                        break;
+                    }
+                    data=slot.in.data();
+                }
+                int64_t packed=(checksums || compressLevel>0)
+                               ?hashCompress(zs, data, len, checksums, compressLevel>0, slot.out, slot.checksum):-1;
+                slot.compressed=packed>=0;
+                slot.data=slot.compressed?slot.out.data():data;
+                slot.length=slot.compressed?packed:len;
+                {
+                    std::lock_guard<std::mutex> lk(m);
+                    slot.index=i;
+                }
+                cv.notify_all();
+            }
+            if (compressLevel>0) deflateEnd(&zs);
+        });
+    bool ok=true;
+    for (size_t i=0; ok && i<order.size(); i++) {
+        Slot &slot=ring[i%depth];
         {
-            strcat(result, buf_ps);
-            if(strlen(result)>65536)
+            auto start=std::chrono::steady_clock::now();
+            std::unique_lock<std::mutex> lk(m);
+            cv.wait(lk, [&]() { return slot.index==(int64_t)i || stop; });
+            stats.waited+=std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+            if (slot.index!=(int64_t)i) {
+                ok=false;
                 break;
+            }
         }
-        pclose(ptr);
-        ptr = NULL;
-        std::cout<<result;
+        int status=sendChunk(imageN, version, order[i], slot.data, slot.length, slot.compressed, checksums, slot.checksum);
+        stats.wireBytes+=slot.length;
+        if (status!=8) {
+            std::cout<<"Chunk#"<<order[i]<<" of Image#"<<imageN<<", Version#"<<version
+                     <<(status==0?" could not be sent":" was refused")<<"\n";
+            stats.refused++;
+            ok=status!=0;
+        }
+        {
+            std::lock_guard<std::mutex> lk(m);
+            consumed=i+1;
+            stop=stop || !ok;
+        }
+        cv.notify_all();
     }
-    else
     {
-        printf("popen %s error\n", ps);
+        std::lock_guard<std::mutex> lk(m);
+        stop=true;
     }
-    delete[] buf_ps;
-    delete[] result;
+    cv.notify_all();
+    for (auto &w:workers) w.join();
+    if (unread>=0)
+        std::cout<<"Cannot read chunk#"<<unread<<" of Image#"<<imageN<<", Version#"<<version<<": "
+                 <<(readErrno!=0?strerror(readErrno):"the file is shorter than announced")<<"\n";
+    return ok;
 }
 
-int main(int argc, char** argv) {
-    if (argc!=5) {
-        std::cout<<"controller [container ID] [image name] [recover node] [image#]\n";
-        return 0;
+//Smallest of a few KeepAlive round trips, in seconds.
+double measureRTT(recover_service::Stub *stub) {
+    double best=1;
+    for (int i=0; i<3; i++) {
+        ClientContext cc;
+        Reply rpl, rpl0;
+        auto start=std::chrono::steady_clock::now();
+        if (!stub->KeepAlive(&cc, rpl0, &rpl).ok()) continue;
+        best=std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count());
     }
-    containerID=argv[1];
-    imageName=argv[2];
-    recoverAddr=argv[3];
+    return best;
+}
 
-    auto channel=CreateChannel(recoverAddr, grpc::InsecureChannelCredentials());
-    auto stub=recover_service::NewStub(channel);
+//Chunks are sent one RPC at a time, so every chunk pays one round trip on top of its
+//transfer time. Picking about 8x the bandwidth-delay product keeps that overhead near
+//10%; lossy transfers (chunks had to be resent) get smaller chunks to resend.
+int64_t pickChunkSize(double rtt) {
+    if (fixedChunkSize>0) return fixedChunkSize;
+    if (lastThroughput<=0) return defaultChunkSize;
+    double target=8*lastThroughput*rtt;
+    if (lastResendRatio>0.01) target/=2;
+    int64_t chunkSize=minChunkSize;
+    while (chunkSize<maxChunkSize && chunkSize<target) chunkSize*=2;
+    return chunkSize;
+}
 
-    int imageN;
-    sscanf(argv[4], "%d", &imageN);
+//Messages of a transfer are built on an arena that starts on this block, so they need no
+//heap allocations of their own.
+char messageBlock[16*1024];
+
+//Small versions travel with their header in one RPC. Returns false when the recoverer
+//is not ready to take it that way, and the caller falls back to chunks.
+bool pushFile(recover_service::Stub *stub, int imageN, int version, int base, FILE *p, int64_t size) {
+    google::protobuf::Arena arena(messageBlock, sizeof(messageBlock));
+    InlineVersion *iv=google::protobuf::Arena::CreateMessage<InlineVersion>(&arena);
+    Reply *rpl=google::protobuf::Arena::CreateMessage<Reply>(&arena);
+    iv->mutable_version()->set_image(imageN);
+    iv->mutable_version()->set_version(version);
+    iv->mutable_version()->set_size(size);
+    iv->mutable_version()->set_full(base<0);
+    iv->mutable_version()->set_base(base);
+    iv->mutable_version()->set_changeset(base>=0 && isChangeset(version));
+    std::string *data=iv->mutable_data();
+    data->resize(size);
+    fseeko(p, 0, SEEK_SET);
+    if ((int64_t)fread(&(*data)[0], 1, size, p)!=size) return false;
+    auto start=std::chrono::steady_clock::now();
+    ClientContext cc;
+    Status st=stub->PushVersion(&cc, *iv, rpl);
+    if (!st.ok() || rpl->status()!=8) return false;
+    std::cout<<"Pushed Image#"<<imageN<<", Version#"<<version<<": "<<size<<" bytes in "
+             <<std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-start).count()<<"ms (inline)\n\n";
+    return true;
+}
 
-    //Iteration 0
-    char commandStr[1024];
-    char *buffer;
-    buffer=new char[1024*1024];
-
-    //Commit to image 0
-    sprintf(commandStr, "docker commit %s %s:0", containerID.c_str(), imageName.c_str());
-    std::cout<<"Committing to Image#"<<0<<"\n\n";
-    executeCMD(commandStr);
-    std::cout<<"\n";
-
-    //Save Image
-    sprintf(commandStr, "docker save -o img0 %s:0", imageName.c_str());
-    std::cout<<"Saving Image #"<<0<<"\n\n";
-    executeCMD(commandStr);
-    std::cout<<"\n";
-
-    FILE* p;
-    std::string filename;
-    filename="img0";
-    p=fopen(filename.c_str(), "rb");
+//Announces the file as the given version of imageN (a diff onto base, or a full image
+//if base is -1), sends every chunk, then resends whatever the recoverer still reports
+//missing. Returns false if the recoverer kept refusing the version or could not be
+//reached.
+bool sendFile(recover_service::Stub *stub, int imageN, int version, int base, const std::string &filename,
+              int64_t resumeChunkSize=0) {
+    FILE* p=fopen(filename.c_str(), "rb");
     if (p==nullptr) assert(false);
+    fseeko(p, 0, SEEK_END);
+    int64_t size=ftello(p);
+    if (inlineLimit>0 && size<=inlineLimit && pushFile(stub, imageN, version, base, p, size)) {
+        fclose(p);
+        return true;
+    }
+    double rtt=measureRTT(stub);
+    //A transfer the recoverer already started must keep its chunk size to be resumed
+    int64_t chunkSize=resumeChunkSize>0?resumeChunkSize:pickChunkSize(rtt);
+    int64_t chunkNum=(size+chunkSize-1)/chunkSize;
 
     Reply rpl;
     Version vs;
     vs.set_image(imageN);
-    vs.set_version(0);
-    fseek(p, 0, SEEK_END);
-    int size=ftell(p);
+    vs.set_version(version);
     vs.set_size(size);
-    int chunkNum=(size+1024*1024-1)/(1024*1024);
-
-    Chunk ck;
-    ChunkList ckl;
-
+    vs.set_chunk_size(chunkSize);
+    vs.set_full(base<0);
+    vs.set_base(base);
+    vs.set_changeset(base>=0 && isChangeset(version));
+    //Chunks are sent from the mapped file; reading into the ring is the fallback
+    char *map=nullptr;
+    posix_fadvise(fileno(p), 0, 0, POSIX_FADV_SEQUENTIAL);
+    if (size>0) {
+        void *m=mmap(nullptr, size, PROT_READ, MAP_SHARED, fileno(p), 0);
+        if (m!=MAP_FAILED) {
+            map=(char*)m;
+            madvise(m, size, MADV_SEQUENTIAL);
+        }
+    }
     rpl.set_status(9);
-    while(rpl.status()!=8) {
+    //The recoverer may still be patching the previous version; give it a while
+    for (int tries=0; rpl.status()!=8; tries++) {
+        if (tries==100) {
+            if (map!=nullptr) munmap(map, size);
+            fclose(p);
+            return false;
+        }
+        if (tries>0) std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        ClientContext cc;
+        stub->TellVersion(&cc, vs, &rpl);
+    }
+
+    //Always start from what the recoverer reports missing: everything for a new
+    //transfer (a single range), only the rest for a resumed one
+    auto start=std::chrono::steady_clock::now();
+    std::clock_t cpuStart=std::clock();
+    int64_t sent=0, resent=0;
+    SendStats stats;
+    google::protobuf::Arena arena(messageBlock, sizeof(messageBlock));
+    Image *imgn=google::protobuf::Arena::CreateMessage<Image>(&arena);
+    imgn->set_image(imageN);
+    ChunkList *ckl=google::protobuf::Arena::CreateMessage<ChunkList>(&arena);
+    ClientContext cc;
+    bool ok=stub->Chunk2Send(&cc, *imgn, ckl).ok();
+    for (int round=0; ok && ckl->missing_size()!=0; round++) {
+        std::vector<int64_t> order;
+        for (auto &range:ckl->missing()) {
+            for (int64_t ii=range.first(); ii<range.first()+range.count(); ii++) order.push_back(ii);
+            sent+=range.count();
+            if (round>0) resent+=range.count();
+        }
         ClientContext cc2;
-        stub->TellVersion(&cc2, vs, &rpl);
+        ok=sendChunks(imageN, version, map, fileno(p), size, chunkSize, order, stats)
+           && stub->Chunk2Send(&cc2, *imgn, ckl).ok();
+    }
+    if (map!=nullptr) munmap(map, size);
+    fclose(p);
+    if (!ok) {
+        std::cout<<"Stopped sending Image#"<<imageN<<", Version#"<<version<<"\n\n";
+        return false;
     }
 
+    double seconds=std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+    double cpuSeconds=(double)(std::clock()-cpuStart)/CLOCKS_PER_SEC;
+    int64_t bytes=std::min(size, sent*chunkSize);
+    if (seconds>0 && sent>=4) lastThroughput=bytes/seconds;   //Tiny transfers say little about the link
+    lastResendRatio=sent>0?(double)resent/sent:0;
+    std::cout<<"Sent Image#"<<imageN<<", Version#"<<version<<": "<<bytes<<" of "<<size<<" bytes in "<<seconds*1000<<"ms ("
+             <<(seconds>0?bytes/seconds/1048576:0)<<" MiB/s), chunk "<<chunkSize/1024<<" KiB"
+             <<(resumeChunkSize>0?" (resumed)":fixedChunkSize>0?" (fixed)":" (auto)")<<", rtt "<<rtt*1000<<"ms, "
+             <<sent<<" of "<<chunkNum<<" chunks sent, "<<resent<<" resent, "<<stats.refused<<" refused, cpu "
+             <<(bytes>0?cpuSeconds*1000*1073741824/bytes:0)<<"ms/GiB"<<(map!=nullptr?" (mapped)":"")<<", waited "
+             <<stats.waited*1000<<"ms for chunks "<<readDepth<<" deep, "<<stats.wireBytes<<" bytes on the wire\n\n";
+    return true;
+}
+
+int64_t fileSize(const std::string &filename) {
+    struct stat st;
+    return stat(filename.c_str(), &st)==0?st.st_size:-1;
+}
+
+//Brings the recoverer to version cur (whose image is img<cur>) from whatever it has,
+//by the route with the fewest bytes: the next diff, replaying kept diffs, one
+//cumulative diff from an image still on disk, or the full image. A change set has no
+//image of its own; its full form is the chain's base image plus every change set since.
+//Returns false if there is no route, i.e. that chain can no longer reach the recoverer.
+bool syncVersion(recover_service::Stub *stub, int imageN, int cur) {
     Image imgn;
     imgn.set_image(imageN);
+    //A cumulative diff is kept across retries while the recoverer stays at the version it
+    //was computed from
+    std::string cumulFile="cdiff"+std::to_string(cur);
+    int cumulFrom=-1;
+    auto finish=[&](bool ok) {
+        if (cumulFrom>=0) unlink(cumulFile.c_str());
+        return ok;
+    };
+    while (1) {
+        VersionState vst;
+        ClientContext cc;
+        if (!stub->GetVersion(&cc, imgn, &vst).ok()) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            continue;
+        }
+        //Wait for a fully received version to be patched before judging where it is
+        if (vst.receiving()>=0 && vst.receiving()!=cur && vst.missing()==0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            continue;
+        }
+        int have=vst.applied();
+        if (have==cur || (vst.receiving()==cur && vst.missing()==0)) return finish(true);
+        int64_t resume=vst.receiving()==cur?vst.chunk_size():0;
+        if (cur>0 && have==cur-1 && fileSize("diff"+std::to_string(cur))>=0) {
+            if (sendFile(stub, imageN, cur, have, "diff"+std::to_string(cur), resume)) return finish(true);
+            continue;
+        }
+
+        int64_t fullCost=fileSize("img"+std::to_string(cur));
+        bool rebase=fullCost<0 && isChangeset(cur);
+        if (rebase) {
+            fullCost=fileSize("img"+std::to_string(chainBase));
+            int found=0;
+            for (auto &d:diffHistory)
+                if (d.first>chainBase && d.first<=cur) {
+                    fullCost+=d.second;
+                    found++;
+                }
+            if (found!=cur-chainBase) fullCost=-1;
+        }
+        int64_t replayCost=-1;
+        if (have>=0 && have<cur) {
+            replayCost=0;
+            int found=0;
+            for (auto &d:diffHistory)
+                if (d.first>have && d.first<=cur) {
+                    replayCost+=d.second;
+                    found++;
+                }
+            if (found!=cur-have) replayCost=-1;
+        }
+        int64_t cumulCost=-1;
+        int64_t otherCost=replayCost>=0 && (fullCost<0 || replayCost<fullCost)?replayCost:fullCost;
+        if (cumulFrom>=0 && cumulFrom!=have) {
+            unlink(cumulFile.c_str());
+            cumulFrom=-1;
+        }
+        if (cumulFrom>=0) cumulCost=fileSize(cumulFile);
+        else if (!rebase && (otherCost<0 || otherCost>cumulativeMin) && have>=0 && have<cur-1
+                 && fileSize("img"+std::to_string(have))>=0) {
+            std::cout<<"Computing cumulative data for Image#"<<cur<<" from Image#"<<have<<"\n\n";
+            if (executeCMD({"bsdiff", "img"+std::to_string(have), "img"+std::to_string(cur), cumulFile}, nullptr,
+                           diffTimeoutMs)==0) {
+                cumulFrom=have;
+                cumulCost=fileSize(cumulFile);
+            }
+            else {
+                std::cout<<"Cannot compute the cumulative data for Image#"<<cur<<"\n\n";
+                unlink(cumulFile.c_str());
+            }
+        }
+        std::cout<<"Recoverer of Image#"<<imageN<<" is at Version#"<<have<<", catching up to Version#"<<cur
+                 <<": full "<<fullCost<<(rebase?" (from Version#"+std::to_string(chainBase)+")":"")<<", replay "
+                 <<replayCost<<", cumulative "<<cumulCost<<" bytes\n\n";
+        if (fullCost<0 && replayCost<0) return finish(false);
+
+        bool ok;
+        if (cumulCost>=0 && (replayCost<0 || cumulCost<replayCost) && cumulCost<fullCost)
+            ok=sendFile(stub, imageN, cur, have, cumulFile, resume);
+        else if (replayCost>=0 && (fullCost<0 || replayCost<fullCost)) {
+            ok=true;
+            for (int v=have+1; ok && v<=cur; v++)
+                ok=sendFile(stub, imageN, v, v-1, "diff"+std::to_string(v), vst.receiving()==v?vst.chunk_size():0);
+        }
+        else if (rebase) {
+            ok=sendFile(stub, imageN, chainBase, -1, "img"+std::to_string(chainBase), vst.receiving()==chainBase?vst.chunk_size():0);
+            for (int v=chainBase+1; ok && v<=cur; v++)
+                ok=sendFile(stub, imageN, v, v-1, "diff"+std::to_string(v), vst.receiving()==v?vst.chunk_size():0);
+        }
+        else ok=sendFile(stub, imageN, cur, -1, "img"+std::to_string(cur), resume);
+        if (ok) return finish(true);
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+}
+
+//The last version captured, the diffs kept and the base of its chain of change sets (-1
+//for none) are saved in cursor_<image#> so a restarted controller continues from there.
+void saveCursor(int imageN, int version) {
+    std::string name="cursor_"+std::to_string(imageN);
+    std::string tmpname=name+".tmp";
+    FILE *p=fopen(tmpname.c_str(), "w");
+    if (p==nullptr) return;
+    fprintf(p, "%d %zu %d\n", version, diffHistory.size(), chainBase);
+    for (auto &d:diffHistory) fprintf(p, "%d %lld\n", d.first, (long long)d.second);
+    fflush(p);
+    fsync(fileno(p));
+    fclose(p);
+    rename(tmpname.c_str(), name.c_str());
+}
+
+//Returns the version to continue from, or -1 to start over; base gets the start of its
+//chain of change sets, -1 for none.
+int loadCursor(int imageN, int &base) {
+    FILE *p=fopen(("cursor_"+std::to_string(imageN)).c_str(), "r");
+    if (p==nullptr) return -1;
+    int version=-1, v;
+    size_t n;
+    long long size;
+    char line[128];
+    int fields=fgets(line, sizeof(line), p)!=nullptr?sscanf(line, "%d %zu %d", &version, &n, &base):0;
+    //Cursors without the base were only saved at the start of a chain
+    if (fields==2) base=captureMode==CAPTURE_UPPERDIR?version:-1;
+    if (fields>=2)
+        for (size_t i=0; i<n && fscanf(p, "%d %lld", &v, &size)==2; i++)
+            if (fileSize("diff"+std::to_string(v))==size) diffHistory.push_back({v, size});
+    fclose(p);
+    if (fields<2 || fileSize("img"+std::to_string(base>=0?base:version))<0) {
+        diffHistory.clear();
+        return -1;
+    }
+    return version;
+}
+
+//How a checkpoint is committed:
+//  pause   as docker does by default, with the container paused for the whole commit
+//  live    without pausing it, so files written meanwhile may be captured half written
+//  freeze  paused only while its upperdir is reflinked (cp --reflink=always) into a twin
+//          container that is created but never started, which is then committed unpaused.
+//          Reflinks copy no data, so the pause grows with the number of entries, not their
+//          size. Needs overlay2, docker's storage on this host and a filesystem with
+//          reflinks under it (btrfs, XFS); without them it is refused. The images get the
+//          config of the image the container runs, not its own. Change sets are read
+//          from the twin the same way (see captureChanges). The twin is removed when
+//          the controller is stopped by SIGINT or SIGTERM.
+enum CheckpointMode {CHECKPOINT_PAUSE=0, CHECKPOINT_LIVE, CHECKPOINT_FREEZE};
+const char *checkpointNames[]={"pause", "live", "freeze"};
+CheckpointMode checkpointMode=CHECKPOINT_PAUSE;
+std::string sourceUpper, twinUpper;
+
+//Pause times so far against the SLO (ms, 0 for none)
+int64_t pauseSLO=0;
+int64_t pauseCount=0, pauseOver=0, pauseWorst=0;
+
+std::string twinName() {
+    return containerID+"-checkpoint";
+}
+
+//Whether files under dir can be reflinked, tried on a scratch file there.
+bool canReflink(const std::string &dir) {
+    std::string probe=dir+"/.reflink-probe";
+    FILE *p=fopen(probe.c_str(), "w");
+    if (p==nullptr) return false;
+    bool ok=fputs("probe", p)>=0;
+    ok=fclose(p)==0 && ok && executeCMD({"cp", "--reflink=always", probe, probe+"-copy"})==0;
+    unlink(probe.c_str());
+    unlink((probe+"-copy").c_str());
+    return ok;
+}
+
+//Creates the twin freeze checkpoints are committed from; returns false, with no twin
+//left, if that cannot work here.
+bool prepareTwin() {
+    std::string image;
+    if (!dockerOK(docker.inspectContainer(containerID, &image, &sourceUpper), "inspect", containerID)) return false;
+    if (sourceUpper.empty()) {
+        std::cout<<containerID<<" has no overlay upperdir\n";
+        return false;
+    }
+    ContainerSpec twin;
+    twin.name=twinName();
+    twin.image=image;
+    docker.removeContainer(twin.name);
+    if (!dockerOK(docker.create(twin), "create", twin.name)) return false;
+    if (dockerOK(docker.inspectContainer(twin.name, nullptr, &twinUpper), "inspect", twin.name) && !twinUpper.empty()) {
+        if (canReflink(twinUpper)) return true;
+        std::cout<<"No reflinks under "<<twinUpper<<", so freezing would copy the whole upperdir while paused\n";
+    }
+    dockerOK(docker.removeContainer(twin.name), "rm", twin.name);
+    return false;
+}
+
+//Removes the twin when the controller is told to stop. Blocks SIGINT and SIGTERM, so it
+//has to run before any other thread starts; a thread of its own takes them.
+void removeTwinOnExit() {
+    sigset_t stop;
+    sigemptyset(&stop);
+    sigaddset(&stop, SIGINT);
+    sigaddset(&stop, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stop, nullptr);
+    std::thread([stop]() {
+        int sig;
+        sigwait(&stop, &sig);
+        std::cout<<"Stopping, removing "<<twinName()<<std::endl;
+        dockerOK(docker.removeContainer(twinName()), "rm", twinName());
+        std::cout.flush();
+        _exit(128+sig);
+    }).detach();
+}
+
+//Commits the container as <image name>:<i>, running frozen (if given) on the upperdir as
+//the commit captures it: the container's while it is paused, or under freeze the twin's
+//once it holds the copy. Returns how long the container was paused, in ms, or -1 if the
+//commit failed.
+int64_t checkpoint(int i, const std::function<void(const std::string&)> &frozen=nullptr) {
+    std::string tag=std::to_string(i);
+    auto start=std::chrono::steady_clock::now();
+    auto since=[&start]() {
+        return (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()-start).count();
+    };
+    if (checkpointMode==CHECKPOINT_LIVE) {
+        if (frozen) frozen(sourceUpper);
+        return dockerOK(docker.commit(containerID, imageName, tag, false), "commit", containerID)?0:-1;
+    }
+    if (checkpointMode==CHECKPOINT_FREEZE) {
+        //Empty the twin first, so only the copy happens while frozen
+        executeCMD({"find", twinUpper, "-mindepth", "1", "-delete"});
+        start=std::chrono::steady_clock::now();
+        if (dockerOK(docker.pause(containerID), "pause", containerID)) {
+            bool copied=executeCMD({"cp", "-a", "--reflink=always", sourceUpper+"/.", twinUpper+"/"})==0;
+            dockerOK(docker.unpause(containerID), "unpause", containerID);
+            int64_t paused=since();
+            if (copied && frozen) frozen(twinUpper);
+            if (copied && dockerOK(docker.commit(twinName(), imageName, tag, false), "commit", twinName()))
+                return paused;
+            std::cout<<(copied?"Committing the twin failed":"Copying the upperdir failed")<<", committing paused\n";
+        }
+        start=std::chrono::steady_clock::now();
+    }
+    if (frozen && dockerOK(docker.pause(containerID), "pause", containerID)) {
+        frozen(sourceUpper);
+        bool committed=dockerOK(docker.commit(containerID, imageName, tag, false), "commit", containerID);
+        dockerOK(docker.unpause(containerID), "unpause", containerID);
+        return committed?since():-1;
+    }
+    if (frozen) frozen(sourceUpper);
+    //Docker keeps it paused throughout, so this is the whole commit
+    return dockerOK(docker.commit(containerID, imageName, tag), "commit", containerID)?since():-1;
+}
+
+void countPause(int64_t ms) {
+    pauseCount++;
+    pauseWorst=std::max(pauseWorst, ms);
+    if (pauseSLO>0 && ms>pauseSLO) pauseOver++;
+}
+
+void reportPause(int i, int64_t ms) {
+    countPause(ms);
+    std::cout<<"Checkpoint of Image#"<<i<<" paused the container for "<<ms<<"ms ("<<checkpointNames[checkpointMode]<<")";
+    if (pauseSLO>0)
+        std::cout<<(ms>pauseSLO?", over":", within")<<" the "<<pauseSLO<<"ms SLO: "<<pauseOver<<" of "<<pauseCount
+                 <<" over so far, worst "<<pauseWorst<<"ms";
+    std::cout<<"\n\n";
+}
+
+//What an upperdir entry looked like at a capture. Anything different is captured again.
+struct UpperEntry {
+    unsigned long long ino;
+    unsigned mode;
+    long long size;
+    struct timespec mtime, ctime;
+};
+typedef std::map<std::string, UpperEntry> UpperManifest;
+UpperManifest upperManifest;        //As of the last capture
+
+//Under freeze entries are read from a reflinked copy, which has new inodes and ctimes
+//every time, so they are told apart by mode, size and mtime only: a change of owner or
+//xattrs alone, or a rewrite that puts the mtime back, waits until the entry changes again.
+bool sameEntry(const UpperEntry &a, const UpperEntry &b) {
+    bool same=a.mode==b.mode && a.size==b.size && a.mtime.tv_sec==b.mtime.tv_sec && a.mtime.tv_nsec==b.mtime.tv_nsec;
+    if (checkpointMode==CHECKPOINT_FREEZE) return same;
+    return same && a.ino==b.ino && a.ctime.tv_sec==b.ctime.tv_sec && a.ctime.tv_nsec==b.ctime.tv_nsec;
+}
+
+std::string parentOf(const std::string &path) {
+    size_t slash=path.rfind('/');
+    return slash==std::string::npos?"":path.substr(0, slash);
+}
+
+UpperManifest *walking;
+size_t walkRoot;
+
+int noteEntry(const char *path, const struct stat *st, int, struct FTW*) {
+    if (path[walkRoot]=='\0') return 0;           //The upperdir itself
+    (*walking)[path+walkRoot+1]={(unsigned long long)st->st_ino, (unsigned)st->st_mode, (long long)st->st_size,
+                                 st->st_mtim, st->st_ctim};
+    return 0;
+}
 
+UpperManifest walkUpper(const std::string &dir) {
+    UpperManifest m;
+    walking=&m;
+    walkRoot=dir.size();
+    nftw(dir.c_str(), noteEntry, 64, FTW_PHYS);
+    return m;
+}
 
-    for (int ii=0;ii<chunkNum;ii++){
-        int toSend=size-ii*1024*1024;
-        if (toSend>1024*1024) toSend=1024*1024;
-        fseek(p, ii*1024*1024, SEEK_SET);
-        fread(buffer, 1, toSend, p);
-        std::string bytes(buffer, toSend);
-        ck.set_image(imageN);
-        ck.set_version(0);
-        ck.set_number(ii);
-        ck.set_data(std::move(bytes));
-        ck.set_checksum(0);
-        ClientContext cc3;
-        stub->SendChunk(&cc3, ck, &rpl);
-    }
-
-    ClientContext cc7;
-    stub->Chunk2Send(&cc7, imgn, &ckl);
-    while(ckl.needed_size()!=0) {
-        for (auto ii:ckl.needed()){
-            int toSend=size-ii*1024*1024;
-            if (toSend>1024*1024) toSend=1024*1024;
-            fseek(p, ii*1024*1024, SEEK_SET);
-            fread(buffer, 1, toSend, p);
-            std::string bytes(buffer, toSend);
-            ck.set_image(imageN);
-            ck.set_version(0);
-            ck.set_data(std::move(bytes));
-            ClientContext cc4;
-            stub->SendChunk(&cc4, ck, &rpl);
-        }
-        ClientContext cc5;
-        stub->Chunk2Send(&cc5, imgn, &ckl);
+//The manifest of the last version of a chain is kept in manifest<version>, so a
+//restarted controller can carry the chain on.
+void saveManifest(int version) {
+    std::string name="manifest"+std::to_string(version);
+    std::string tmpname=name+".tmp";
+    FILE *p=fopen(tmpname.c_str(), "w");
+    if (p==nullptr) return;
+    for (auto &e:upperManifest) {
+        if (e.first.find('\n')!=std::string::npos) continue;    //Just captured again next time
+        const UpperEntry &u=e.second;
+        fprintf(p, "%llu %o %lld %lld %ld %lld %ld %s\n", u.ino, u.mode, u.size, (long long)u.mtime.tv_sec,
+                u.mtime.tv_nsec, (long long)u.ctime.tv_sec, u.ctime.tv_nsec, e.first.c_str());
     }
+    fflush(p);
+    fsync(fileno(p));
     fclose(p);
+    rename(tmpname.c_str(), name.c_str());
+}
 
-    for (int i=1; i<2147483647; i++) {
+bool loadManifest(int version) {
+    FILE *p=fopen(("manifest"+std::to_string(version)).c_str(), "r");
+    if (p==nullptr) return false;
+    upperManifest.clear();
+    UpperEntry u;
+    long long mtime, ctime;
+    char path[4096];
+    while (fscanf(p, "%llu %o %lld %lld %ld %lld %ld", &u.ino, &u.mode, &u.size, &mtime, &u.mtime.tv_nsec,
+                  &ctime, &u.ctime.tv_nsec)==7 && fgetc(p)==' ' && fgets(path, sizeof(path), p)!=nullptr) {
+        path[strcspn(path, "\n")]='\0';
+        u.mtime.tv_sec=mtime;
+        u.ctime.tv_sec=ctime;
+        upperManifest[path]=u;
+    }
+    fclose(p);
+    return true;
+}
+
+//Writes the change set of version i to diff<i>, unless nothing changed; entries gets how
+//many entries it holds. Under freeze the container is only paused while its upperdir is
+//reflinked into the twin, which is then walked and read; otherwise it is paused (unless
+//live) for the walk and the tar. Returns how long the container was paused, in ms, or -1
+//if the change set could not be made.
+int64_t captureChanges(int i, size_t &entries) {
+    std::string out="diff"+std::to_string(i);
+    std::string listFile="changes"+std::to_string(i);
+    std::string root=sourceUpper;
+    auto start=std::chrono::steady_clock::now();
+    auto since=[&start]() {
+        return (int64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()-start).count();
+    };
+    bool paused=false;
+    int64_t pausedMs=0;
+    if (checkpointMode==CHECKPOINT_FREEZE) {
+        executeCMD({"find", twinUpper, "-mindepth", "1", "-delete"});
+        start=std::chrono::steady_clock::now();
+        if (dockerOK(docker.pause(containerID), "pause", containerID)) {
+            bool copied=executeCMD({"cp", "-a", "--reflink=always", sourceUpper+"/.", twinUpper+"/"})==0;
+            dockerOK(docker.unpause(containerID), "unpause", containerID);
+            pausedMs=since();
+            if (!copied) return -1;
+            root=twinUpper;
+        }
+    }
+    else paused=checkpointMode!=CHECKPOINT_LIVE && dockerOK(docker.pause(containerID), "pause", containerID);
+    UpperManifest now=walkUpper(root);
+    //Entries go in with every directory above them, so those keep their attributes too
+    std::set<std::string> members;
+    size_t changed=0, removedN=0;
+    for (auto &e:now) {
+        auto it=upperManifest.find(e.first);
+        if (it!=upperManifest.end() && sameEntry(it->second, e.second)) continue;
+        changed++;
+        for (std::string p=e.first; !p.empty() && members.insert(p).second; p=parentOf(p));
+    }
+    std::string removed;
+    for (auto &e:upperManifest) {
+        if (now.count(e.first)) continue;
+        std::string parent=parentOf(e.first);
+        if (!parent.empty() && upperManifest.count(parent) && !now.count(parent)) continue;    //Went with its directory
+        removed.append(e.first.c_str(), e.first.size()+1);
+        removedN++;
+        for (std::string p=parent; !p.empty() && members.insert(p).second; p=parentOf(p));
+    }
+    entries=changed+removedN;
+    if (entries==0) {
+        if (paused) dockerOK(docker.unpause(containerID), "unpause", containerID);
+        return paused?since():pausedMs;
+    }
+    FILE *l=fopen(listFile.c_str(), "wb");
+    if (l==nullptr) {
+        if (paused) dockerOK(docker.unpause(containerID), "unpause", containerID);
+        return -1;
+    }
+    for (auto &m:members) fwrite(m.c_str(), 1, m.size()+1, l);
+    fclose(l);
+    //Files changing or going while read (1, or skipped) only happen to a live capture; the
+    //next capture sees them changed or removed again
+    int ret=executeCMD({"tar", "--create", "--file", out, "--directory", root, "--no-recursion", "--null",
+                        "--files-from", listFile, "--numeric-owner", "--xattrs", "--xattrs-include=trusted.*",
+                        "--ignore-failed-read", "--blocking-factor", "1"});
+    if (paused) {
+        dockerOK(docker.unpause(containerID), "unpause", containerID);
+        pausedMs=since();
+    }
+    unlink(listFile.c_str());
+    FILE *p=ret==0 || ret==1?fopen(out.c_str(), "ab"):nullptr;
+    if (p==nullptr) return -1;
+    uint64_t length=removed.size();
+    bool ok=fwrite(removed.data(), 1, removed.size(), p)==removed.size() && fwrite(&length, 8, 1, p)==1
+            && fwrite("UPPERCS1", 8, 1, p)==1;
+    if (fclose(p)!=0 || !ok) return -1;
+    upperManifest.swap(now);
+    std::cout<<"Captured "<<changed<<" changed and "<<removedN<<" removed entries for Image#"<<i<<": "
+             <<fileSize(out)<<" bytes\n\n";
+    return pausedMs;
+}
+
+int savedManifest=-1;               //Version of the manifest on disk, -1 for none
+
+//Saves the manifest and the cursor of version i, the last of the chain, then drops the
+//manifest they replace.
+void saveChain(int imageN, int i) {
+    saveManifest(i);
+    saveCursor(imageN, i);
+    if (savedManifest>=0 && savedManifest!=i) unlink(("manifest"+std::to_string(savedManifest)).c_str());
+    savedManifest=i;
+}
+
+//Version i, just saved in full, becomes the base of the change sets that follow.
+void startChain(int imageN, int i) {
+    if (chainBase>=0 && chainBase!=i) {
+        std::string oldTag=imageName+":"+std::to_string(chainBase);
+        dockerOK(docker.removeImage(oldTag), "rmi", oldTag);
+        unlink(("img"+std::to_string(chainBase)).c_str());
+    }
+    for (auto &d:diffHistory) unlink(("diff"+std::to_string(d.first)).c_str());
+    diffHistory.clear();
+    unlink(("diff"+std::to_string(i)).c_str());       //Left by an older chain
+    chainBase=i;
+    saveChain(imageN, i);
+}
+
+int main(int argc, char** argv) {
+    if (argc!=5 && argc!=6) {
+        std::cout<<"controller [container ID] [image name] [recover node] [image#] [config file]\n";
+        return 0;
+    }
+
+    //Config lines:
+    //  chunk auto|<KiB>        chunk size, tuned per transfer by default
+    //  inline <KiB>            largest version sent in one PushVersion, 0 to disable
+    //  history <n>             diffs kept for recoverers that fall behind
+    //  cumulative <KiB>        least cost of the other routes that makes a cumulative diff worth computing
+    //  difftimeout <s>         kill bsdiff after this long, 0 for no limit
+    //  readahead <chunks>      how far reading runs ahead of sending
+    //  workers <n>             threads reading (and checksumming, compressing) chunks
+    //  checksum on|off         send the crc32 of every chunk
+    //  compress <level>        deflate chunks at this zlib level, 0 to disable
+    //  checkpoint <mode>       pause|live|freeze, how the container is committed (see CheckpointMode)
+    //  pauseslo <ms>           pause time each checkpoint is reported against
+    //  capture save|upperdir   what each version is made of (see CaptureMode)
+    //  interval <ms>           least time between the starts of two captures
+    //  docker <socket path>    the Docker Engine API socket (default DOCKER_HOST if it
+    //                          is unix://, else /var/run/docker.sock)
+    if (argc==6) {
+        FILE* config=fopen(argv[5], "r");
+        if (config==nullptr) {
+            std::cout<<"Cannot open "<<argv[5]<<"\n";
+            return 0;
+        }
+        char key[64], value[256];
+        while (fscanf(config, "%63s %255s", key, value)==2) {
+            if (strcmp(key, "chunk")==0) {
+                fixedChunkSize=strcmp(value, "auto")==0?0:atoll(value)*1024;
+                if (fixedChunkSize!=0) fixedChunkSize=std::max(minChunkSize, std::min(maxChunkSize, fixedChunkSize));
+            }
+            else if (strcmp(key, "history")==0) historyDepth=atoi(value);
+            else if (strcmp(key, "cumulative")==0) cumulativeMin=atoll(value)*1024;
+            else if (strcmp(key, "difftimeout")==0) diffTimeoutMs=atoi(value)*1000;
+            else if (strcmp(key, "readahead")==0) readDepth=std::max(1, atoi(value));
+            else if (strcmp(key, "workers")==0) readWorkers=std::max(1, atoi(value));
+            else if (strcmp(key, "checksum")==0) checksums=strcmp(value, "on")==0;
+            else if (strcmp(key, "compress")==0) compressLevel=std::max(0, std::min(9, atoi(value)));
+            else if (strcmp(key, "docker")==0) docker.socketPath=value;
+            else if (strcmp(key, "checkpoint")==0)
+                checkpointMode=strcmp(value, "live")==0?CHECKPOINT_LIVE:(strcmp(value, "freeze")==0?CHECKPOINT_FREEZE:CHECKPOINT_PAUSE);
+            else if (strcmp(key, "pauseslo")==0) pauseSLO=atoll(value);
+            else if (strcmp(key, "capture")==0) captureMode=strcmp(value, "upperdir")==0?CAPTURE_UPPERDIR:CAPTURE_SAVE;
+            else if (strcmp(key, "interval")==0) captureInterval=std::max(0LL, atoll(value));
+            else if (strcmp(key, "inline")==0) inlineLimit=std::min(maxChunkSize, (int64_t)atoll(value)*1024);
+            else std::cout<<"Unknown config key "<<key<<"\n";
+        }
+        fclose(config);
+    }
+    containerID=argv[1];
+    imageName=argv[2];
+    recoverAddr=argv[3];
+    if (checkpointMode==CHECKPOINT_FREEZE && !prepareTwin()) {
+        std::cout<<"Cannot checkpoint by freezing, committing paused instead\n\n";
+        checkpointMode=CHECKPOINT_PAUSE;
+    }
+    if (checkpointMode==CHECKPOINT_FREEZE) removeTwinOnExit();
+    if (captureMode==CAPTURE_UPPERDIR && sourceUpper.empty()
+        && (!dockerOK(docker.inspectContainer(containerID, nullptr, &sourceUpper), "inspect", containerID) || sourceUpper.empty())) {
+        std::cout<<"No overlay upperdir to capture, saving every version instead\n\n";
+        captureMode=CAPTURE_SAVE;
+    }
+
+    if (!chunkEncodingOK()) {
+        std::cout<<"Chunks would not encode as recover_service.proto says\n";
+        return 1;
+    }
+    grpc::ChannelArguments channelArgs;
+    channelArgs.SetMaxSendMessageSize(maxChunkSize+64*1024);
+    auto channel=CreateCustomChannel(recoverAddr, grpc::InsecureChannelCredentials(), channelArgs);
+    auto stub=recover_service::NewStub(channel);
+    grpc::GenericStub genericStub(channel);
+    grpc::CompletionQueue cq;
+    rawStub=&genericStub;
+    rawCQ=&cq;
+
+    int imageN;
+    sscanf(argv[4], "%d", &imageN);
+
+    int first=0;
+    int base=-1;
+    int last=loadCursor(imageN, base);
+    //A chain goes on from the manifest of its last change set; without it, or capturing
+    //otherwise now, it cannot
+    if (last>=0 && base>=0) {
+        if (captureMode==CAPTURE_UPPERDIR && loadManifest(last)) {
+            chainBase=base;
+            savedManifest=last;
+        }
+        else {
+            std::cout<<"Cannot carry on the chain of Image#"<<imageN<<" from Version#"<<base<<", starting over\n\n";
+            diffHistory.clear();
+            last=-1;
+        }
+    }
+    //The version in the cursor; its image, and any newer one, stays on disk until a later
+    //version's diff is in the cursor
+    int saved=last;
+    if (last>=0) {
+        //Finish whatever the recoverer was missing of the last version, then carry on
+        std::cout<<"Resuming Image#"<<imageN<<" after Version#"<<last<<"\n\n";
+        syncVersion(stub.get(), imageN, last);
+        first=last+1;
+    }
+
+    auto lastCapture=std::chrono::steady_clock::now()-std::chrono::milliseconds(captureInterval);
+    for (int i=first; i<2147483647; i++) {
+        std::this_thread::sleep_until(lastCapture+std::chrono::milliseconds(captureInterval));
+        lastCapture=std::chrono::steady_clock::now();
+
+        if (captureMode==CAPTURE_UPPERDIR && chainBase>=0) {
+            size_t entries=0;
+            int64_t paused=captureChanges(i, entries);
+            if (paused<0) {
+                std::cout<<"Cannot capture the changes to Image#"<<i<<", starting a new chain\n\n";
+                unlink(("diff"+std::to_string(i)).c_str());
+                chainBase=-1;
+                continue;
+            }
+            if (entries==0) {
+                countPause(paused);
+                i--;
+                continue;
+            }
+            reportPause(i, paused);
+            diffHistory.push_back({i, fileSize("diff"+std::to_string(i))});
+            while ((int)diffHistory.size()>historyDepth) {
+                unlink(("diff"+std::to_string(diffHistory.front().first)).c_str());
+                diffHistory.pop_front();
+            }
+            saveChain(imageN, i);
+            if (!syncVersion(stub.get(), imageN, i)) {
+                std::cout<<"Recoverer of Image#"<<imageN<<" is out of reach of the chain, starting a new one\n\n";
+                chainBase=-1;
+            }
+            continue;
+        }
 
         //Commit to image
-        sprintf(commandStr, "docker commit %s %s:%d", containerID.c_str(), imageName.c_str(), i);
+        std::string tag=imageName+":"+std::to_string(i);
         std::cout<<"Committing to Image#"<<i<<"\n\n";
-        executeCMD(commandStr);
-        std::cout<<"\n";
+        int64_t paused=captureMode==CAPTURE_UPPERDIR?checkpoint(i, [](const std::string &dir) { upperManifest=walkUpper(dir); })
+                                                     :checkpoint(i);
+        if (paused<0) {
+            std::cout<<"Cannot commit Image#"<<i<<", trying again\n\n";
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            i--;
+            continue;
+        }
+        reportPause(i, paused);
 
-        //Save Image
-        sprintf(commandStr, "docker save -o img%d %s:%d", i, imageName.c_str(), i);
+        //Save Image, streamed from the daemon into the file
         std::cout<<"Saving Image #"<<i<<"\n\n";
-        executeCMD(commandStr);
-        std::cout<<"\n";
+        std::string imgFile="img"+std::to_string(i);
+        int fd=open(imgFile.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644);
+        if (fd<0) std::cout<<"Cannot create "<<imgFile<<"\n";
+        bool stored=fd>=0 && dockerOK(docker.save(tag, fd), "save", tag);
+        if (fd>=0) stored=close(fd)==0 && stored && fileSize(imgFile)>0;
+        if (!stored) {
+            //Nothing of Version#i goes out, nor into the cursor; it is committed again
+            std::cout<<"Cannot save Image#"<<i<<", trying again\n\n";
+            unlink(imgFile.c_str());
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            i--;
+            continue;
+        }
+
+        if (captureMode==CAPTURE_UPPERDIR) {
+            startChain(imageN, i);
+            syncVersion(stub.get(), imageN, i);
+            continue;
+        }
+
+        if (i==0) {
+            saveCursor(imageN, 0);
+            saved=0;
+            syncVersion(stub.get(), imageN, 0);
+            continue;
+        }
 
         //Diff
-        sprintf(commandStr, "bsdiff img%d img%d diff%d", i-1, i, i);
+        std::string diffFile="diff"+std::to_string(i);
         std::cout<<"Computing incremental data for Image#"<<i<<"\n\n";
-        executeCMD(commandStr);
-        std::cout<<"\n";
+        auto bsdiff=startCMD({"bsdiff", "img"+std::to_string(i-1), imgFile, diffFile});
 
-        //Removing old image
-        sprintf(commandStr, "docker rmi %s:%d", imageName.c_str(), i-1);
+        //Removing old image, while the diff is computed
+        std::string oldTag=imageName+":"+std::to_string(i-1);
         std::cout<<"Removing old image in docker.\n\n";
-        executeCMD(commandStr);
-        std::cout<<"\n";
+        dockerOK(docker.removeImage(oldTag), "rmi", oldTag);
 
-        //Removing old image in files
-        if (i!=1) {
-            sprintf(commandStr, "rm img%d", i-1);
-            std::cout<<"Removing old image in disk.\n\n";
-            executeCMD(commandStr);
-            std::cout<<"\n";
-        }
-
-        FILE* p;
-        std::string filename;
-        if (i==0) filename="img0"; else filename="diff"+std::to_string(i);
-        p=fopen(filename.c_str(), "rb");
-        if (p==nullptr) assert(false);
-
-        Reply rpl;
-        Version vs;
-        vs.set_image(imageN);
-        vs.set_version(i);
-        fseek(p, 0, SEEK_END);
-        int size=ftell(p);
-        vs.set_size(size);
-        int chunkNum=(size+1024*1024-1)/(1024*1024);
-
-        rpl.set_status(9);
-        while(rpl.status()!=8) {
-            ClientContext cc6;
-            stub->TellVersion(&cc6, vs, &rpl);
-        }
-
-        Chunk ck;
-        ChunkList ckl;
-
-        ClientContext cc8;
-        stub->Chunk2Send(&cc8, imgn, &ckl);
-
-        Image imgn;
-        imgn.set_image(imageN);
-
-        for (int ii=0;ii<chunkNum;ii++){
-            int toSend=size-ii*1024*1024;
-            if (toSend>1024*1024) toSend=1024*1024;
-            fseek(p, ii*1024*1024, SEEK_SET);
-            fread(buffer, 1, toSend, p);
-            std::string bytes(buffer, toSend);
-            ck.set_image(imageN);
-            ck.set_version(i);
-            ck.set_data(std::move(bytes));
-            ClientContext cc9;
-            stub->SendChunk(&cc9, ck, &rpl);
-        }
-
-        ClientContext cc10;
-        stub->Chunk2Send(&cc10, imgn, &ckl);
-        while(ckl.needed_size()!=0) {
-            for (auto ii:ckl.needed()){
-                int toSend=size-ii*1024*1024;
-                if (toSend>1024*1024) toSend=1024*1024;
-                fseek(p, ii*1024*1024, SEEK_SET);
-                fread(buffer, 1, toSend,  p);
-                std::string bytes(buffer, toSend);
-                ck.set_image(imageN);
-                ck.set_version(i);
-                ck.set_number(ii);
-                ck.set_data(std::move(bytes));
-                ClientContext cc11;
-                stub->SendChunk(&cc11, ck, &rpl);
-            }
-            ClientContext cc12;
-            stub->Chunk2Send(&cc12, imgn, &ckl);
+        bool diffed=bsdiff->wait(diffTimeoutMs)==0;
+        if (bsdiff->timedOut()) std::cout<<"bsdiff of Image#"<<i<<" killed after "<<diffTimeoutMs<<"ms\n";
+        std::cout<<"\n";
+        if (!diffed) {
+            //Without diff<i> the cursor stays where it is, with its image; Version#i still
+            //goes out in full or as a cumulative diff
+            std::cout<<"Cannot compute the incremental data for Image#"<<i<<", keeping Image#"<<saved<<"\n\n";
+            unlink(diffFile.c_str());
+            syncVersion(stub.get(), imageN, i);
+            continue;
         }
-        fclose(p);
+        diffHistory.push_back({i, fileSize(diffFile)});
+        while ((int)diffHistory.size()>historyDepth) {
+            unlink(("diff"+std::to_string(diffHistory.front().first)).c_str());
+            diffHistory.pop_front();
+        }
+        saveCursor(imageN, i);
+
+        //Removing old images in files, those kept while diffs failed included
+        std::cout<<"Removing old image in disk.\n\n";
+        for (int v=std::max(saved, 1); v<i; v++) unlink(("img"+std::to_string(v)).c_str());
+        saved=i;
+
+        syncVersion(stub.get(), imageN, i);
     }
 
-    delete[] buffer;
     return 0;
 }
@@ -0,0 +1,393 @@
+//
+// Docker Engine API over the daemon's Unix socket, for the operations the controller
+// and the recoverer use, without forking the docker CLI.
+//
+
+#include "docker_client.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <strings.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <sys/un.h>
+
+namespace {
+
+//Reads a response off the socket: header lines, then the body as sized, chunked or
+//running to the end of the connection.
+class Reader {
+public:
+    explicit Reader(int fd): fd(fd) {}
+
+    bool line(std::string &out) {
+        while (true) {
+            char *nl=(char*)memchr(buf+pos, '\n', len-pos);
+            if (nl!=nullptr) {
+                size_t end=nl-buf;
+                out.assign(buf+pos, end>pos && buf[end-1]=='\r'?end-pos-1:end-pos);
+                pos=end+1;
+                return true;
+            }
+            if (!fill()) return false;
+        }
+    }
+
+    //Passes n bytes (or everything up to EOF if n<0) to sink
+    bool body(int64_t n, const std::function<bool(const char*, size_t)> &sink) {
+        while (n!=0) {
+            if (pos==len && !fill()) return n<0;
+            size_t take=len-pos;
+            if (n>0 && (int64_t)take>n) take=n;
+            if (!sink(buf+pos, take)) return false;
+            pos+=take;
+            if (n>0) n-=take;
+        }
+        return true;
+    }
+
+    bool chunked(const std::function<bool(const char*, size_t)> &sink) {
+        std::string size;
+        while (line(size)) {
+            int64_t n=strtoll(size.c_str(), nullptr, 16);
+            if (n==0) {
+                while (line(size) && !size.empty());                //Trailers
+                return true;
+            }
+            if (!body(n, sink) || !line(size)) return false;
+        }
+        return false;
+    }
+
+private:
+    int fd;
+    char buf[65536];
+    size_t pos=0, len=0;
+
+    bool fill() {
+        if (pos==len) pos=len=0;
+        else if (pos>0) {
+            memmove(buf, buf+pos, len-pos);
+            len-=pos;
+            pos=0;
+        }
+        if (len==sizeof(buf)) return false;                 //A header line this long is not HTTP
+        while (true) {
+            ssize_t got=read(fd, buf+len, sizeof(buf)-len);
+            if (got<0 && errno==EINTR) continue;
+            if (got<=0) return false;
+            len+=got;
+            return true;
+        }
+    }
+};
+
+bool writeAll(int fd, const char *data, size_t n) {
+    while (n>0) {
+        ssize_t put=write(fd, data, n);
+        if (put<0 && errno==EINTR) continue;
+        if (put<=0) return false;
+        data+=put;
+        n-=put;
+    }
+    return true;
+}
+
+bool sendAll(int sock, int fd, int64_t n) {
+    off_t offset=lseek(fd, 0, SEEK_CUR);
+    while (n>0) {
+        ssize_t put=sendfile(sock, fd, &offset, n);
+        if (put<0 && errno==EINTR) continue;
+        if (put<0 && (errno==EINVAL || errno==ENOSYS || errno==ESPIPE)) break;
+        if (put<=0) return false;
+        n-=put;
+    }
+    if (n==0) return true;
+    //Not something sendfile takes, e.g. a pipe
+    if (offset>=0 && lseek(fd, offset, SEEK_SET)<0) return false;
+    char buf[65536];
+    while (n>0) {
+        ssize_t got=read(fd, buf, std::min<int64_t>(n, sizeof(buf)));
+        if (got<0 && errno==EINTR) continue;
+        if (got<=0 || !writeAll(sock, buf, got)) return false;
+        n-=got;
+    }
+    return true;
+}
+
+std::string escapeQuery(const std::string &s) {
+    std::string out;
+    char hex[4];
+    for (unsigned char c:s) {
+        if (isalnum(c) || c=='-' || c=='_' || c=='.' || c=='~') out+=c;
+        else {
+            sprintf(hex, "%%%02X", c);
+            out+=hex;
+        }
+    }
+    return out;
+}
+
+std::string jsonString(const std::string &s) {
+    std::string out="\"";
+    char hex[8];
+    for (unsigned char c:s) {
+        if (c=='"' || c=='\\') {
+            out+='\\';
+            out+=c;
+        } else if (c<0x20) {
+            sprintf(hex, "\\u%04x", c);
+            out+=hex;
+        } else out+=c;
+    }
+    return out+"\"";
+}
+
+//The string value of the first "key" in a JSON text, unescaped enough for messages
+std::string jsonField(const std::string &json, const char *key, size_t from=0) {
+    std::string k=std::string("\"")+key+"\"";
+    size_t at=json.find(k, from);
+    if (at==std::string::npos) return "";
+    at=json.find('"', json.find(':', at+k.size()));
+    if (at==std::string::npos) return "";
+    std::string out;
+    for (size_t i=at+1; i<json.size() && json[i]!='"'; i++) {
+        if (json[i]!='\\' || i+1==json.size()) {
+            out+=json[i];
+            continue;
+        }
+        char e=json[++i];
+        out+=e=='n'?'\n':e=='t'?'\t':e;
+    }
+    return out;
+}
+
+std::string imagePath(const std::string &image, const std::string &what) {
+    return "/images/"+image+what;
+}
+
+}
+
+DockerClient::DockerClient() {
+    const char *host=getenv("DOCKER_HOST");
+    if (host!=nullptr && strncmp(host, "unix://", 7)==0) socketPath=host+7;
+    else socketPath="/var/run/docker.sock";
+}
+
+DockerStatus DockerClient::request(const char *method, const std::string &path, const std::string &body,
+                                   const char *contentType, int bodyFd, int64_t bodySize,
+                                   const std::function<bool(const char*, size_t)> &sink) {
+    DockerStatus status;
+    struct sockaddr_un addr{};
+    addr.sun_family=AF_UNIX;
+    if (socketPath.size()>=sizeof(addr.sun_path)) {
+        status.message="socket path too long: "+socketPath;
+        return status;
+    }
+    strcpy(addr.sun_path, socketPath.c_str());
+    int sock=socket(AF_UNIX, SOCK_STREAM|SOCK_CLOEXEC, 0);
+    if (sock<0 || connect(sock, (struct sockaddr*)&addr, sizeof(addr))!=0) {
+        status.message="cannot connect to "+socketPath+": "+strerror(errno);
+        if (sock>=0) close(sock);
+        return status;
+    }
+    int64_t length=bodyFd>=0?bodySize:(int64_t)body.size();
+    char header[512];
+    int n=snprintf(header, sizeof(header), "Host: docker\r\nConnection: close\r\nContent-Length: %lld\r\n%s%s%s\r\n",
+                   (long long)length, contentType?"Content-Type: ":"", contentType?contentType:"", contentType?"\r\n":"");
+    std::string head=std::string(method)+" "+path+" HTTP/1.1\r\n"+std::string(header, n);
+    bool sent=writeAll(sock, head.data(), head.size())
+              && (bodyFd>=0?sendAll(sock, bodyFd, bodySize):writeAll(sock, body.data(), body.size()));
+    int sendErrno=sent?0:errno;
+    //A body cut short would leave the daemon waiting for the rest
+    if (!sent) shutdown(sock, SHUT_WR);
+    //The daemon may have answered early, e.g. refusing a load, so read whatever came back
+    Reader in(sock);
+    std::string line;
+    if (!in.line(line) || sscanf(line.c_str(), "HTTP/%*s %d", &status.http)!=1) {
+        status.http=0;
+        status.message=std::string("no response from ")+socketPath+(sent?"":": "+std::string(strerror(sendErrno)));
+        close(sock);
+        return status;
+    }
+    int64_t contentLength=-1;
+    bool isChunked=false;
+    while (in.line(line) && !line.empty()) {
+        if (strncasecmp(line.c_str(), "Content-Length:", 15)==0) contentLength=strtoll(line.c_str()+15, nullptr, 10);
+        else if (strncasecmp(line.c_str(), "Transfer-Encoding:", 18)==0) isChunked=strstr(line.c_str(), "chunked")!=nullptr;
+    }
+    std::string kept;
+    auto keep=[&](const char *data, size_t n) {
+        kept.append(data, n);
+        return true;
+    };
+    std::function<bool(const char*, size_t)> to=status.ok() && sink?sink:keep;
+    bool complete=isChunked?in.chunked(to):in.body(status.http==204 || status.http==304?0:contentLength, to);
+    close(sock);
+    if (!status.ok()) {
+        status.message=jsonField(kept, "message");
+        if (status.message.empty()) status.message=kept;
+    } else if (!sent) {
+        status.message="request body not sent: "+std::string(strerror(sendErrno));
+        status.http=0;
+    } else if (!complete) {
+        status.message="response cut short";
+        status.http=0;
+    }
+    return status;
+}
+
+DockerStatus DockerClient::commit(const std::string &container, const std::string &repo, const std::string &tag,
+                                  bool pause) {
+    return request("POST", "/commit?container="+escapeQuery(container)+"&repo="+escapeQuery(repo)+"&tag="+escapeQuery(tag)
+                   +(pause?"":"&pause=0"),
+                   "{}", "application/json");
+}
+
+DockerStatus DockerClient::save(const std::string &image, int fd) {
+    return request("GET", imagePath(image, "/get"), "", nullptr, -1, 0,
+                   [fd](const char *data, size_t n) { return writeAll(fd, data, n); });
+}
+
+DockerStatus DockerClient::load(int fd, int64_t size, std::string *loaded) {
+    std::string progress;
+    DockerStatus status=request("POST", "/images/load?quiet=1", "", "application/x-tar", fd, size,
+                                [&](const char *data, size_t n) {
+                                    progress.append(data, n);
+                                    return true;
+                                });
+    if (!status.ok()) return status;
+    //A stream of {"stream":"..."} objects; failures part way come as {"error":"..."}
+    std::string error=jsonField(progress, "error");
+    if (!error.empty()) {
+        status.http=500;
+        status.message=error;
+        return status;
+    }
+    for (size_t at=0; (at=progress.find("\"stream\"", at))!=std::string::npos; at++) {
+        std::string text=jsonField(progress, "stream", at);
+        for (const char *prefix:{"Loaded image: ", "Loaded image ID: "}) {
+            if (text.compare(0, strlen(prefix), prefix)!=0) continue;
+            text=text.substr(strlen(prefix));
+            while (!text.empty() && isspace((unsigned char)text.back())) text.pop_back();
+            if (loaded!=nullptr) *loaded=text;
+        }
+    }
+    return status;
+}
+
+DockerStatus DockerClient::inspectImage(const std::string &image) {
+    return request("GET", imagePath(image, "/json"), "", nullptr, -1, 0,
+                   [](const char*, size_t) { return true; });
+}
+
+DockerStatus DockerClient::tag(const std::string &image, const std::string &repo, const std::string &tag) {
+    return request("POST", imagePath(image, "/tag?repo="+escapeQuery(repo)+"&tag="+escapeQuery(tag)), "");
+}
+
+DockerStatus DockerClient::removeImage(const std::string &image) {
+    return request("DELETE", imagePath(image, ""), "", nullptr, -1, 0,
+                   [](const char*, size_t) { return true; });
+}
+
+DockerStatus DockerClient::removeContainer(const std::string &name) {
+    return request("DELETE", "/containers/"+name+"?force=1", "");
+}
+
+DockerStatus DockerClient::inspectContainer(const std::string &name, std::string *image, std::string *upperDir) {
+    std::string json;
+    DockerStatus status=request("GET", "/containers/"+name+"/json", "", nullptr, -1, 0,
+                                [&](const char *data, size_t n) {
+                                    json.append(data, n);
+                                    return true;
+                                });
+    if (!status.ok()) return status;
+    //The top level "Image" (an ID) comes before Config's (a name)
+    if (image!=nullptr) *image=jsonField(json, "Image");
+    if (upperDir!=nullptr) *upperDir=jsonField(json, "UpperDir");
+    return status;
+}
+
+DockerStatus DockerClient::create(const ContainerSpec &spec) {
+    std::string body="{\"Image\":"+jsonString(spec.image);
+    if (!spec.cmd.empty()) {
+        body+=",\"Cmd\":[";
+        for (size_t i=0; i<spec.cmd.size(); i++) body+=(i?",":"")+jsonString(spec.cmd[i]);
+        body+="]";
+    }
+    std::string exposed, bindings;
+    char port[128];
+    for (auto &p:spec.ports) {
+        snprintf(port, sizeof(port), "\"%d/tcp\":{}", p.first);
+        exposed+=(exposed.empty()?"":",")+std::string(port);
+        snprintf(port, sizeof(port), "\"%d/tcp\":[{\"HostPort\":\"%d\"}]", p.first, p.second);
+        bindings+=(bindings.empty()?"":",")+std::string(port);
+    }
+    body+=",\"ExposedPorts\":{"+exposed+"},\"HostConfig\":{\"PortBindings\":{"+bindings+"}";
+    if (spec.memMB>0) body+=",\"Memory\":"+std::to_string((int64_t)spec.memMB<<20);
+    body+="}}";
+    return request("POST", "/containers/create?name="+escapeQuery(spec.name), body, "application/json",
+                   -1, 0, [](const char*, size_t) { return true; });
+}
+
+DockerStatus DockerClient::start(const std::string &name) {
+    return request("POST", "/containers/"+name+"/start", "");
+}
+
+DockerStatus DockerClient::pause(const std::string &name) {
+    return request("POST", "/containers/"+name+"/pause", "");
+}
+
+DockerStatus DockerClient::unpause(const std::string &name) {
+    return request("POST", "/containers/"+name+"/unpause", "");
+}
+
+DockerStatus DockerClient::rename(const std::string &name, const std::string &newName) {
+    return request("POST", "/containers/"+name+"/rename?name="+escapeQuery(newName), "");
+}
+
+DockerStatus DockerClient::run(const ContainerSpec &spec) {
+    DockerStatus status=create(spec);
+    return status.ok()?start(spec.name):status;
+}
+
+bool dockerOK(const DockerStatus &status, const char *what, const std::string &name) {
+    if (!status.ok()) std::cout<<"docker "<<what<<" "<<name<<" failed ("<<status.http<<"): "<<status.message<<"\n";
+    return status.ok();
+}
+
+std::vector<std::string> splitWords(const std::string &line) {
+    std::vector<std::string> words;
+    std::string word;
+    bool inWord=false;
+    char quote=0;
+    for (size_t i=0; i<line.size(); i++) {
+        char c=line[i];
+        if (quote!=0) {
+            if (c==quote) quote=0;
+            else if (c=='\\' && quote=='"' && i+1<line.size() && strchr("\"\\$`", line[i+1])) word+=line[++i];
+            else word+=c;
+        } else if (c=='\'' || c=='"') {
+            quote=c;
+            inWord=true;
+        } else if (c=='\\' && i+1<line.size()) {
+            word+=line[++i];
+            inWord=true;
+        } else if (isspace((unsigned char)c)) {
+            if (inWord) words.push_back(word);
+            word.clear();
+            inWord=false;
+        } else {
+            word+=c;
+            inWord=true;
+        }
+    }
+    if (inWord) words.push_back(word);
+    return words;
+}
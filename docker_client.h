@@ -0,0 +1,77 @@
+//
+// Docker Engine API over the daemon's Unix socket, for the operations the controller
+// and the recoverer use, without forking the docker CLI.
+//
+
+#ifndef AUTORECOVERER_DOCKER_CLIENT_H
+#define AUTORECOVERER_DOCKER_CLIENT_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+//Outcome of a call: the HTTP status (0 if the daemon could not be reached or answered
+//garbage) and, on failure, the daemon's message or what went wrong locally.
+struct DockerStatus {
+    int http=0;
+    std::string message;
+
+    bool ok() const { return http>=200 && http<300; }
+};
+
+//What docker create/run would be told on the command line.
+struct ContainerSpec {
+    std::string name;
+    std::string image;
+    std::vector<std::string> cmd;                   //Empty for the image's default
+    std::vector<std::pair<int, int>> ports;         //(container port, host port), tcp
+    int memMB=0;                                    //0 for no limit
+};
+
+class DockerClient {
+public:
+    //The socket is DOCKER_HOST (unix:// only) if set, else /var/run/docker.sock.
+    DockerClient();
+    explicit DockerClient(std::string socketPath): socketPath(std::move(socketPath)) {}
+
+    //Without pause the container keeps running, so files it writes meanwhile may be
+    //captured half written.
+    DockerStatus commit(const std::string &container, const std::string &repo, const std::string &tag,
+                        bool pause=true);
+    //Streams the image as a tar into fd.
+    DockerStatus save(const std::string &image, int fd);
+    //Streams size bytes of tar from fd into the daemon; loaded gets the name:tag (or
+    //sha256: ID for untagged saves) the daemon reports.
+    DockerStatus load(int fd, int64_t size, std::string *loaded);
+    DockerStatus inspectImage(const std::string &image);
+    DockerStatus tag(const std::string &image, const std::string &repo, const std::string &tag);
+    DockerStatus removeImage(const std::string &image);
+    DockerStatus removeContainer(const std::string &name);    //Forced, like rm -f
+    //The image ID a container runs and, for overlay2, the directory holding its changes.
+    DockerStatus inspectContainer(const std::string &name, std::string *image, std::string *upperDir);
+    DockerStatus create(const ContainerSpec &spec);
+    DockerStatus start(const std::string &name);
+    DockerStatus pause(const std::string &name);
+    DockerStatus unpause(const std::string &name);
+    DockerStatus rename(const std::string &name, const std::string &newName);
+    DockerStatus run(const ContainerSpec &spec);              //create then start
+
+    std::string socketPath;
+
+private:
+    //Sends one request, its body from body or else bodySize bytes of bodyFd, and passes
+    //the response body to sink, or keeps it in the status message if the call failed.
+    DockerStatus request(const char *method, const std::string &path, const std::string &body,
+                         const char *contentType=nullptr, int bodyFd=-1, int64_t bodySize=0,
+                         const std::function<bool(const char*, size_t)> &sink=nullptr);
+};
+
+//Logs a failed call as "docker <what> <name> failed"; returns whether it succeeded.
+bool dockerOK(const DockerStatus &status, const char *what, const std::string &name);
+
+//Splits a command line into words the way a shell would for plain and quoted words.
+std::vector<std::string> splitWords(const std::string &line);
+
+#endif //AUTORECOVERER_DOCKER_CLIENT_H
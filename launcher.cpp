@@ -0,0 +1,124 @@
+//
+// Runs external commands (bsdiff, bspatch, ...) with posix_spawn.
+//
+
+#include "launcher.h"
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <cerrno>
+#include <csignal>
+#include <spawn.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+Process::Process(const std::vector<std::string> &argv) {
+    int fds[2];
+    if (argv.empty() || pipe2(fds, O_CLOEXEC)!=0) return;
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
+    //Signals blocked here, e.g. those a thread waits for, stay deliverable to the command
+    sigset_t none;
+    sigemptyset(&none);
+    posix_spawnattr_setsigmask(&attr, &none);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP|POSIX_SPAWN_SETSIGMASK);
+    posix_spawnattr_setpgroup(&attr, 0);
+    std::vector<char*> args;
+    for (auto &a:argv) args.push_back(const_cast<char*>(a.c_str()));
+    args.push_back(nullptr);
+    if (posix_spawnp(&pid, args[0], &actions, &attr, args.data(), environ)!=0) pid=-1;
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attr);
+    close(fds[1]);
+    if (pid>0) outFd=fds[0];
+    else close(fds[0]);
+}
+
+Process::~Process() {
+    if (pid>0 && !done) {
+        kill();
+        wait();
+    }
+    if (outFd>=0) close(outFd);
+}
+
+void Process::kill() {
+    ::kill(-pid, SIGKILL);
+    expired=true;
+}
+
+int Process::wait(int timeoutMs) {
+    if (pid<=0) return -1;
+    if (done) return status;
+    auto deadline=std::chrono::steady_clock::now()+std::chrono::milliseconds(timeoutMs);
+    auto left=[&]() {
+        return (int)std::chrono::duration_cast<std::chrono::milliseconds>(deadline-std::chrono::steady_clock::now()).count();
+    };
+    char buf[65536];
+    while (outFd>=0 && !expired) {
+        if (timeoutMs>0 && left()<=0) {
+            kill();
+            break;
+        }
+        struct pollfd pfd={outFd, POLLIN, 0};
+        int n=poll(&pfd, 1, timeoutMs>0?std::max(left(), 1):-1);
+        if (n<=0) continue;
+        ssize_t got=read(outFd, buf, sizeof(buf));
+        if (got<0 && (errno==EINTR || errno==EAGAIN)) continue;
+        if (got<=0) break;
+        if (echo) std::cout.write(buf, got);
+        if (keepOutput) output.append(buf, got);
+    }
+    if (outFd>=0) {
+        close(outFd);
+        outFd=-1;
+    }
+    //The command may outlive its stdout
+    int st=0;
+    while (true) {
+        pid_t r=waitpid(pid, &st, timeoutMs>0 && !expired?WNOHANG:0);
+        if (r==pid) break;
+        if (r<0 && errno!=EINTR) {
+            st=-1;
+            break;
+        }
+        if (r==0) {
+            if (left()<=0) kill();
+            else std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    done=true;
+    if (st!=-1 && WIFEXITED(st)) status=WEXITSTATUS(st);
+    else if (st!=-1 && WIFSIGNALED(st)) status=128+WTERMSIG(st);
+    return status;
+}
+
+//The command line as logged
+std::string joinArgs(const std::vector<std::string> &argv) {
+    std::string line;
+    for (auto &a:argv) line+=(line.empty()?"":" ")+a;
+    return line;
+}
+
+std::unique_ptr<Process> startCMD(const std::vector<std::string> &argv) {
+    std::cerr<<joinArgs(argv)<<std::endl;
+    std::unique_ptr<Process> p(new Process(argv));
+    if (!p->started()) std::cout<<"Cannot start "<<joinArgs(argv)<<"\n";
+    return p;
+}
+
+int executeCMD(const std::vector<std::string> &argv, std::string *output, int timeoutMs) {
+    auto p=startCMD(argv);
+    p->keepOutput=output!=nullptr;
+    int ret=p->wait(timeoutMs);
+    if (p->timedOut()) std::cout<<"Killed after "<<timeoutMs<<"ms: "<<joinArgs(argv)<<"\n";
+    if (output!=nullptr) *output=p->output;
+    return ret;
+}
@@ -0,0 +1,54 @@
+//
+// Runs external commands (bsdiff, bspatch, ...) with posix_spawn.
+//
+
+#ifndef AUTORECOVERER_LAUNCHER_H
+#define AUTORECOVERER_LAUNCHER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+//A started command. Its stdout is read through a pipe in wait(), echoed to std::cout as it
+//arrives and, if keepOutput is set, collected in output; stderr goes where ours goes. The
+//command runs in a process group of its own, so a timeout kills everything it started.
+//Output is only read in wait(), so a command that writes a lot stalls until waited for.
+class Process {
+public:
+    explicit Process(const std::vector<std::string> &argv);   //argv[0] is looked up in PATH
+    ~Process();                                                //Kills and reaps it if still running
+    Process(const Process&)=delete;
+    Process& operator=(const Process&)=delete;
+
+    bool started() const { return pid>0; }
+    bool timedOut() const { return expired; }
+
+    //Waits for the command to exit, killing it after timeoutMs (0 for no limit). Returns its
+    //exit status, 128+signal if a signal ended it, or -1 if it could not be started.
+    int wait(int timeoutMs=0);
+
+    bool keepOutput=false;
+    bool echo=true;
+    std::string output;
+
+private:
+    pid_t pid=-1;
+    int outFd=-1;
+    int status=-1;
+    bool done=false;
+    bool expired=false;
+
+    void kill();
+};
+
+//Starts a command without waiting for it. The arguments go to it as they are, no shell
+//in between, so paths need no quoting.
+std::unique_ptr<Process> startCMD(const std::vector<std::string> &argv);
+
+//Runs a command and waits for it, for at most timeoutMs if given. Its output is echoed
+//and, if output is not null, returned in full. Returns the exit status as Process::wait
+//does.
+int executeCMD(const std::vector<std::string> &argv, std::string *output=nullptr, int timeoutMs=0);
+
+#endif //AUTORECOVERER_LAUNCHER_H
@@ -19,8 +19,26 @@ using namespace recoverer;
 
 #include <vector>
 #include <string>
+#include <chrono>
+#include <ctime>
+#include <iostream>
 #include <unistd.h>
 
+//Life cycle of a protected service, as seen by the master:
+//HEALTHY -> SUSPECTED (missed a heartbeat) -> RECOVERING (missed 3, RecoverServ
+//not acknowledged yet) -> RECOVERED (standby took over, never dispatched again)
+//-> FAILED_BACK (the primary answered again after a recovery was dispatched).
+enum ServState {HEALTHY=0, SUSPECTED, RECOVERING, RECOVERED, FAILED_BACK, STATE_COUNT};
+const char* stateNames[STATE_COUNT]={"healthy", "suspected", "recovering", "recovered", "failed-back"};
+
+struct ServStatus {
+    ServState state;
+    time_t entered[STATE_COUNT];   //Last time each state was entered, 0 for never
+    int attempts;                  //RecoverServ calls made in the current recovery
+    int job;                       //Restore job on the standby, 0 if not dispatched yet
+    RecoverPhase phase;            //Last phase reported for that job
+};
+
 std::vector<std::string> addr;
 std::vector<int> recv_node;
 std::vector<std::string> servNames;
@@ -28,7 +46,75 @@ std::vector<std::unique_ptr<recover_service::Stub>> stubs;
 std::vector<std::shared_ptr<Channel>> channels;
 
 std::vector<int> delay_times;
-bool recovered[32];
+std::vector<ServStatus> servStatus;
+
+void transit(int i, ServState to) {
+    ServStatus &st=servStatus[i];
+    time_t now=time(nullptr);
+    char timeStr[32];
+    strftime(timeStr, sizeof(timeStr), "%F %T", localtime(&now));
+    std::cout<<"["<<timeStr<<"] Service#"<<i<<" ("<<servNames[i]<<"): "
+             <<stateNames[st.state]<<" -> "<<stateNames[to];
+    if (st.entered[st.state]!=0) std::cout<<" after "<<now-st.entered[st.state]<<"s";
+    std::cout<<std::endl;
+    st.state=to;
+    st.entered[to]=now;
+    if (to==RECOVERING) {
+        st.attempts=0;
+        st.job=0;
+    }
+}
+
+//Calls RecoverServ once; returns true only when the standby accepted it and gave back a job.
+bool dispatchRecovery(int i) {
+    ClientContext cc;
+    cc.set_deadline(std::chrono::system_clock::now()+std::chrono::seconds(5));
+    RecoverJob rpl;
+    ImageAndServName img;
+    img.set_image(i);
+    img.set_servname(servNames[i]);
+    //When this failure was detected tells it apart from the earlier ones of the service
+    img.set_failure(servStatus[i].entered[RECOVERING]);
+    servStatus[i].attempts++;
+    Status st=stubs[recv_node[i]]->RecoverServ(&cc, img, &rpl);
+    if (!st.ok()) {
+        std::cout<<"RecoverServ for Service#"<<i<<" failed (attempt "<<servStatus[i].attempts<<"): "
+                 <<st.error_message()<<", retrying\n";
+        return false;
+    }
+    if (rpl.status()!=8) {
+        std::cout<<"Standby has no version of Service#"<<i<<" yet (attempt "<<servStatus[i].attempts<<"), retrying\n";
+        return false;
+    }
+    servStatus[i].job=rpl.job();
+    servStatus[i].phase=QUEUED;
+    std::cout<<"Service#"<<i<<" is being restored as job "<<rpl.job()<<" on node "<<recv_node[i]<<"\n";
+    return true;
+}
+
+//Polls the restore job of service i and returns its phase; QUEUED is returned
+//as well when the standby could not be reached this round.
+RecoverPhase pollRecovery(int i) {
+    ClientContext cc;
+    cc.set_deadline(std::chrono::system_clock::now()+std::chrono::seconds(1));
+    RecoverJob job;
+    RecoverJobStatus rpl;
+    job.set_job(servStatus[i].job);
+    Status st=stubs[recv_node[i]]->RecoverStatus(&cc, job, &rpl);
+    if (!st.ok()) return QUEUED;
+    if (rpl.status()!=8) return FAILED;
+    if (rpl.phase()!=servStatus[i].phase) {
+        std::cout<<"Service#"<<i<<" job "<<servStatus[i].job<<": "<<RecoverPhase_Name(rpl.phase())
+                 <<" (Version#"<<rpl.version()<<", "<<rpl.elapsed_ms()<<"ms)\n";
+        if (rpl.phase()==READY) {
+            std::cout<<"Service#"<<i<<" now runs as "<<rpl.container()<<" on node "<<recv_node[i];
+            for (auto &pm:rpl.ports()) std::cout<<", port "<<pm.container_port()<<" -> "<<pm.host_port();
+            std::cout<<"\n";
+        }
+        servStatus[i].phase=rpl.phase();
+    }
+    return rpl.phase();
+}
 
 int main() {
     FILE* config;
@@ -43,6 +129,7 @@ int main() {
     channels.resize(n+1);
     delay_times.resize(n+1);
     servNames.resize(n+1);
+    servStatus.resize(n+1);
     for (int i=1; i<=n; i++){
         fscanf(config, "%s %d %s", buf1, &recv_node[i], buf2);
         addr[i]=buf1;
@@ -53,27 +140,43 @@ int main() {
     delete[] buf1;
     for (int i=1; i<=n; i++) {
         delay_times[i]=0;
-        recovered[i]=false;
+        servStatus[i].state=HEALTHY;
+        for (int s=0; s<STATE_COUNT; s++) servStatus[i].entered[s]=0;
+        servStatus[i].entered[HEALTHY]=time(nullptr);
+        servStatus[i].attempts=0;
+        servStatus[i].job=0;
     }
     while(1) {
         sleep(1);
         for (int i=1; i<=n; i++){
             ClientContext cc;
+            cc.set_deadline(std::chrono::system_clock::now()+std::chrono::seconds(1));
             Reply rpl, rpl0;
             rpl.set_status(9);
             stubs[i]->KeepAlive(&cc, rpl0, &rpl);
-            if (rpl.status()!=8) delay_times[i]++;
-            else delay_times[i]=0;
+            ServState state=servStatus[i].state;
+            if (rpl.status()!=8) {
+                delay_times[i]++;
+                if (state==HEALTHY || state==FAILED_BACK) transit(i, SUSPECTED);
+                else if (state==SUSPECTED && delay_times[i]>=3) transit(i, RECOVERING);
+            }
+            else {
+                delay_times[i]=0;
+                if (state==SUSPECTED) transit(i, HEALTHY);
+                else if (state==RECOVERING && servStatus[i].attempts==0) transit(i, HEALTHY);
+                else if (state==RECOVERING || state==RECOVERED) transit(i, FAILED_BACK);
+            }
         }
         for (int i=1; i<=n; i++){
-            if (delay_times[i]>=3) {
-                ClientContext cc;
-                Reply rpl;
-                ImageAndServName img;
-                img.set_image(i);
-                img.set_servname(servNames[i]);
-                stubs[recv_node[i]]->RecoverServ(&cc, img, &rpl);
+            //Exactly one accepted RecoverServ per failure; errors are retried on the next round
+            if (servStatus[i].state!=RECOVERING) continue;
+            if (servStatus[i].job==0) {
+                dispatchRecovery(i);
+                continue;
             }
+            RecoverPhase phase=pollRecovery(i);
+            if (phase==READY) transit(i, RECOVERED);
+            else if (phase==FAILED) servStatus[i].job=0;
         }
         //break;
     }
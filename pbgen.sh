@@ -1,2 +0,0 @@
-protoc --grpc_out=. --plugin=protoc-gen-grpc=`which grpc_cpp_plugin` recover_service.proto
-protoc --cpp_out=. recover_service.proto
@@ -1,1593 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: recover_service.proto
-
-#include "recover_service.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/extension_set.h>
-#include <google/protobuf/wire_format_lite.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-namespace recoverer {
-class VersionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Version> _instance;
-} _Version_default_instance_;
-class ReplyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Reply> _instance;
-} _Reply_default_instance_;
-class ImageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Image> _instance;
-} _Image_default_instance_;
-class ImageAndServNameDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ImageAndServName> _instance;
-} _ImageAndServName_default_instance_;
-class ChunkDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Chunk> _instance;
-} _Chunk_default_instance_;
-class ChunkListDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ChunkList> _instance;
-} _ChunkList_default_instance_;
-}  // namespace recoverer
-static void InitDefaultsscc_info_Chunk_recover_5fservice_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::recoverer::_Chunk_default_instance_;
-    new (ptr) ::recoverer::Chunk();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::recoverer::Chunk::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Chunk_recover_5fservice_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Chunk_recover_5fservice_2eproto}, {}};
-
-static void InitDefaultsscc_info_ChunkList_recover_5fservice_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::recoverer::_ChunkList_default_instance_;
-    new (ptr) ::recoverer::ChunkList();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::recoverer::ChunkList::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ChunkList_recover_5fservice_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ChunkList_recover_5fservice_2eproto}, {}};
-
-static void InitDefaultsscc_info_Image_recover_5fservice_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::recoverer::_Image_default_instance_;
-    new (ptr) ::recoverer::Image();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::recoverer::Image::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Image_recover_5fservice_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Image_recover_5fservice_2eproto}, {}};
-
-static void InitDefaultsscc_info_ImageAndServName_recover_5fservice_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::recoverer::_ImageAndServName_default_instance_;
-    new (ptr) ::recoverer::ImageAndServName();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::recoverer::ImageAndServName::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ImageAndServName_recover_5fservice_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ImageAndServName_recover_5fservice_2eproto}, {}};
-
-static void InitDefaultsscc_info_Reply_recover_5fservice_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::recoverer::_Reply_default_instance_;
-    new (ptr) ::recoverer::Reply();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::recoverer::Reply::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Reply_recover_5fservice_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Reply_recover_5fservice_2eproto}, {}};
-
-static void InitDefaultsscc_info_Version_recover_5fservice_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::recoverer::_Version_default_instance_;
-    new (ptr) ::recoverer::Version();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::recoverer::Version::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Version_recover_5fservice_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Version_recover_5fservice_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_recover_5fservice_2eproto[6];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_recover_5fservice_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_recover_5fservice_2eproto = nullptr;
-
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_recover_5fservice_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Version, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Version, image_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::Version, version_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::Version, size_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Reply, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Reply, status_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Image, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Image, image_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::recoverer::ImageAndServName, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::recoverer::ImageAndServName, image_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::ImageAndServName, servname_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Chunk, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::recoverer::Chunk, image_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::Chunk, version_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::Chunk, number_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::Chunk, data_),
-  PROTOBUF_FIELD_OFFSET(::recoverer::Chunk, checksum_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::recoverer::ChunkList, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::recoverer::ChunkList, needed_),
-};
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::recoverer::Version)},
-  { 8, -1, sizeof(::recoverer::Reply)},
-  { 14, -1, sizeof(::recoverer::Image)},
-  { 20, -1, sizeof(::recoverer::ImageAndServName)},
-  { 27, -1, sizeof(::recoverer::Chunk)},
-  { 37, -1, sizeof(::recoverer::ChunkList)},
-};
-
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recoverer::_Version_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recoverer::_Reply_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recoverer::_Image_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recoverer::_ImageAndServName_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recoverer::_Chunk_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::recoverer::_ChunkList_default_instance_),
-};
-
-const char descriptor_table_protodef_recover_5fservice_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\025recover_service.proto\022\trecoverer\"7\n\007Ve"
-  "rsion\022\r\n\005image\030\001 \001(\005\022\017\n\007version\030\002 \001(\005\022\014\n"
-  "\004size\030\003 \001(\005\"\027\n\005Reply\022\016\n\006status\030\001 \001(\005\"\026\n\005"
-  "Image\022\r\n\005image\030\001 \001(\005\"3\n\020ImageAndServName"
-  "\022\r\n\005image\030\001 \001(\005\022\020\n\010servname\030\002 \001(\t\"W\n\005Chu"
-  "nk\022\r\n\005image\030\001 \001(\005\022\017\n\007version\030\002 \001(\005\022\016\n\006nu"
-  "mber\030\003 \001(\005\022\014\n\004data\030\004 \001(\014\022\020\n\010checksum\030\005 \001"
-  "(\005\"\033\n\tChunkList\022\016\n\006needed\030\001 \003(\0052\234\002\n\017reco"
-  "ver_service\0223\n\013TellVersion\022\022.recoverer.V"
-  "ersion\032\020.recoverer.Reply\0224\n\nChunk2Send\022\020"
-  ".recoverer.Image\032\024.recoverer.ChunkList\022/"
-  "\n\tSendChunk\022\020.recoverer.Chunk\032\020.recovere"
-  "r.Reply\022/\n\tKeepAlive\022\020.recoverer.Reply\032\020"
-  ".recoverer.Reply\022<\n\013RecoverServ\022\033.recove"
-  "rer.ImageAndServName\032\020.recoverer.Replyb\006"
-  "proto3"
-  ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_recover_5fservice_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_recover_5fservice_2eproto_sccs[6] = {
-  &scc_info_Chunk_recover_5fservice_2eproto.base,
-  &scc_info_ChunkList_recover_5fservice_2eproto.base,
-  &scc_info_Image_recover_5fservice_2eproto.base,
-  &scc_info_ImageAndServName_recover_5fservice_2eproto.base,
-  &scc_info_Reply_recover_5fservice_2eproto.base,
-  &scc_info_Version_recover_5fservice_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_recover_5fservice_2eproto_once;
-static bool descriptor_table_recover_5fservice_2eproto_initialized = false;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_recover_5fservice_2eproto = {
-  &descriptor_table_recover_5fservice_2eproto_initialized, descriptor_table_protodef_recover_5fservice_2eproto, "recover_service.proto", 606,
-  &descriptor_table_recover_5fservice_2eproto_once, descriptor_table_recover_5fservice_2eproto_sccs, descriptor_table_recover_5fservice_2eproto_deps, 6, 0,
-  schemas, file_default_instances, TableStruct_recover_5fservice_2eproto::offsets,
-  file_level_metadata_recover_5fservice_2eproto, 6, file_level_enum_descriptors_recover_5fservice_2eproto, file_level_service_descriptors_recover_5fservice_2eproto,
-};
-
-// Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_recover_5fservice_2eproto = (  ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_recover_5fservice_2eproto), true);
-namespace recoverer {
-
-// ===================================================================
-
-void Version::InitAsDefaultInstance() {
-}
-class Version::_Internal {
- public:
-};
-
-Version::Version()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:recoverer.Version)
-}
-Version::Version(const Version& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&image_, &from.image_,
-    static_cast<size_t>(reinterpret_cast<char*>(&size_) -
-    reinterpret_cast<char*>(&image_)) + sizeof(size_));
-  // @@protoc_insertion_point(copy_constructor:recoverer.Version)
-}
-
-void Version::SharedCtor() {
-  ::memset(&image_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&size_) -
-      reinterpret_cast<char*>(&image_)) + sizeof(size_));
-}
-
-Version::~Version() {
-  // @@protoc_insertion_point(destructor:recoverer.Version)
-  SharedDtor();
-}
-
-void Version::SharedDtor() {
-}
-
-void Version::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Version& Version::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Version_recover_5fservice_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Version::Clear() {
-// @@protoc_insertion_point(message_clear_start:recoverer.Version)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ::memset(&image_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&size_) -
-      reinterpret_cast<char*>(&image_)) + sizeof(size_));
-  _internal_metadata_.Clear();
-}
-
-const char* Version::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 image = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          image_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 version = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 size = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Version::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:recoverer.Version)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_image(), target);
-  }
-
-  // int32 version = 2;
-  if (this->version() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_version(), target);
-  }
-
-  // int32 size = 3;
-  if (this->size() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_size(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:recoverer.Version)
-  return target;
-}
-
-size_t Version::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:recoverer.Version)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_image());
-  }
-
-  // int32 version = 2;
-  if (this->version() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_version());
-  }
-
-  // int32 size = 3;
-  if (this->size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_size());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Version::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:recoverer.Version)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Version* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Version>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:recoverer.Version)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:recoverer.Version)
-    MergeFrom(*source);
-  }
-}
-
-void Version::MergeFrom(const Version& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recoverer.Version)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.image() != 0) {
-    _internal_set_image(from._internal_image());
-  }
-  if (from.version() != 0) {
-    _internal_set_version(from._internal_version());
-  }
-  if (from.size() != 0) {
-    _internal_set_size(from._internal_size());
-  }
-}
-
-void Version::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:recoverer.Version)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Version::CopyFrom(const Version& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:recoverer.Version)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Version::IsInitialized() const {
-  return true;
-}
-
-void Version::InternalSwap(Version* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(image_, other->image_);
-  swap(version_, other->version_);
-  swap(size_, other->size_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Version::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Reply::InitAsDefaultInstance() {
-}
-class Reply::_Internal {
- public:
-};
-
-Reply::Reply()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:recoverer.Reply)
-}
-Reply::Reply(const Reply& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  status_ = from.status_;
-  // @@protoc_insertion_point(copy_constructor:recoverer.Reply)
-}
-
-void Reply::SharedCtor() {
-  status_ = 0;
-}
-
-Reply::~Reply() {
-  // @@protoc_insertion_point(destructor:recoverer.Reply)
-  SharedDtor();
-}
-
-void Reply::SharedDtor() {
-}
-
-void Reply::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Reply& Reply::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Reply_recover_5fservice_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Reply::Clear() {
-// @@protoc_insertion_point(message_clear_start:recoverer.Reply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  status_ = 0;
-  _internal_metadata_.Clear();
-}
-
-const char* Reply::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 status = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Reply::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:recoverer.Reply)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 status = 1;
-  if (this->status() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_status(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:recoverer.Reply)
-  return target;
-}
-
-size_t Reply::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:recoverer.Reply)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // int32 status = 1;
-  if (this->status() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_status());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Reply::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:recoverer.Reply)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Reply* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Reply>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:recoverer.Reply)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:recoverer.Reply)
-    MergeFrom(*source);
-  }
-}
-
-void Reply::MergeFrom(const Reply& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recoverer.Reply)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.status() != 0) {
-    _internal_set_status(from._internal_status());
-  }
-}
-
-void Reply::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:recoverer.Reply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Reply::CopyFrom(const Reply& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:recoverer.Reply)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Reply::IsInitialized() const {
-  return true;
-}
-
-void Reply::InternalSwap(Reply* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(status_, other->status_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Reply::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Image::InitAsDefaultInstance() {
-}
-class Image::_Internal {
- public:
-};
-
-Image::Image()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:recoverer.Image)
-}
-Image::Image(const Image& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  image_ = from.image_;
-  // @@protoc_insertion_point(copy_constructor:recoverer.Image)
-}
-
-void Image::SharedCtor() {
-  image_ = 0;
-}
-
-Image::~Image() {
-  // @@protoc_insertion_point(destructor:recoverer.Image)
-  SharedDtor();
-}
-
-void Image::SharedDtor() {
-}
-
-void Image::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Image& Image::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Image_recover_5fservice_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Image::Clear() {
-// @@protoc_insertion_point(message_clear_start:recoverer.Image)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  image_ = 0;
-  _internal_metadata_.Clear();
-}
-
-const char* Image::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 image = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          image_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Image::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:recoverer.Image)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_image(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:recoverer.Image)
-  return target;
-}
-
-size_t Image::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:recoverer.Image)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_image());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Image::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:recoverer.Image)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Image* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Image>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:recoverer.Image)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:recoverer.Image)
-    MergeFrom(*source);
-  }
-}
-
-void Image::MergeFrom(const Image& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recoverer.Image)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.image() != 0) {
-    _internal_set_image(from._internal_image());
-  }
-}
-
-void Image::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:recoverer.Image)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Image::CopyFrom(const Image& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:recoverer.Image)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Image::IsInitialized() const {
-  return true;
-}
-
-void Image::InternalSwap(Image* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  swap(image_, other->image_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Image::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void ImageAndServName::InitAsDefaultInstance() {
-}
-class ImageAndServName::_Internal {
- public:
-};
-
-ImageAndServName::ImageAndServName()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:recoverer.ImageAndServName)
-}
-ImageAndServName::ImageAndServName(const ImageAndServName& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  servname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_servname().empty()) {
-    servname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.servname_);
-  }
-  image_ = from.image_;
-  // @@protoc_insertion_point(copy_constructor:recoverer.ImageAndServName)
-}
-
-void ImageAndServName::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ImageAndServName_recover_5fservice_2eproto.base);
-  servname_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  image_ = 0;
-}
-
-ImageAndServName::~ImageAndServName() {
-  // @@protoc_insertion_point(destructor:recoverer.ImageAndServName)
-  SharedDtor();
-}
-
-void ImageAndServName::SharedDtor() {
-  servname_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-void ImageAndServName::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ImageAndServName& ImageAndServName::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ImageAndServName_recover_5fservice_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void ImageAndServName::Clear() {
-// @@protoc_insertion_point(message_clear_start:recoverer.ImageAndServName)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  servname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  image_ = 0;
-  _internal_metadata_.Clear();
-}
-
-const char* ImageAndServName::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 image = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          image_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string servname = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_servname();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "recoverer.ImageAndServName.servname"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* ImageAndServName::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:recoverer.ImageAndServName)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_image(), target);
-  }
-
-  // string servname = 2;
-  if (this->servname().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_servname().data(), static_cast<int>(this->_internal_servname().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "recoverer.ImageAndServName.servname");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_servname(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:recoverer.ImageAndServName)
-  return target;
-}
-
-size_t ImageAndServName::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:recoverer.ImageAndServName)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string servname = 2;
-  if (this->servname().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_servname());
-  }
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_image());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void ImageAndServName::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:recoverer.ImageAndServName)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ImageAndServName* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ImageAndServName>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:recoverer.ImageAndServName)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:recoverer.ImageAndServName)
-    MergeFrom(*source);
-  }
-}
-
-void ImageAndServName::MergeFrom(const ImageAndServName& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recoverer.ImageAndServName)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.servname().size() > 0) {
-
-    servname_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.servname_);
-  }
-  if (from.image() != 0) {
-    _internal_set_image(from._internal_image());
-  }
-}
-
-void ImageAndServName::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:recoverer.ImageAndServName)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void ImageAndServName::CopyFrom(const ImageAndServName& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:recoverer.ImageAndServName)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool ImageAndServName::IsInitialized() const {
-  return true;
-}
-
-void ImageAndServName::InternalSwap(ImageAndServName* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  servname_.Swap(&other->servname_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(image_, other->image_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata ImageAndServName::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void Chunk::InitAsDefaultInstance() {
-}
-class Chunk::_Internal {
- public:
-};
-
-Chunk::Chunk()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:recoverer.Chunk)
-}
-Chunk::Chunk(const Chunk& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_data().empty()) {
-    data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  ::memcpy(&image_, &from.image_,
-    static_cast<size_t>(reinterpret_cast<char*>(&checksum_) -
-    reinterpret_cast<char*>(&image_)) + sizeof(checksum_));
-  // @@protoc_insertion_point(copy_constructor:recoverer.Chunk)
-}
-
-void Chunk::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Chunk_recover_5fservice_2eproto.base);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&image_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&checksum_) -
-      reinterpret_cast<char*>(&image_)) + sizeof(checksum_));
-}
-
-Chunk::~Chunk() {
-  // @@protoc_insertion_point(destructor:recoverer.Chunk)
-  SharedDtor();
-}
-
-void Chunk::SharedDtor() {
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-void Chunk::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Chunk& Chunk::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Chunk_recover_5fservice_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Chunk::Clear() {
-// @@protoc_insertion_point(message_clear_start:recoverer.Chunk)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(&image_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&checksum_) -
-      reinterpret_cast<char*>(&image_)) + sizeof(checksum_));
-  _internal_metadata_.Clear();
-}
-
-const char* Chunk::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 image = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          image_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 version = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 number = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // bytes data = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // int32 checksum = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Chunk::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:recoverer.Chunk)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_image(), target);
-  }
-
-  // int32 version = 2;
-  if (this->version() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_version(), target);
-  }
-
-  // int32 number = 3;
-  if (this->number() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_number(), target);
-  }
-
-  // bytes data = 4;
-  if (this->data().size() > 0) {
-    target = stream->WriteBytesMaybeAliased(
-        4, this->_internal_data(), target);
-  }
-
-  // int32 checksum = 5;
-  if (this->checksum() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(5, this->_internal_checksum(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:recoverer.Chunk)
-  return target;
-}
-
-size_t Chunk::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:recoverer.Chunk)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // bytes data = 4;
-  if (this->data().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-        this->_internal_data());
-  }
-
-  // int32 image = 1;
-  if (this->image() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_image());
-  }
-
-  // int32 version = 2;
-  if (this->version() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_version());
-  }
-
-  // int32 number = 3;
-  if (this->number() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_number());
-  }
-
-  // int32 checksum = 5;
-  if (this->checksum() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_checksum());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Chunk::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:recoverer.Chunk)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Chunk* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Chunk>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:recoverer.Chunk)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:recoverer.Chunk)
-    MergeFrom(*source);
-  }
-}
-
-void Chunk::MergeFrom(const Chunk& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recoverer.Chunk)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.data().size() > 0) {
-
-    data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.data_);
-  }
-  if (from.image() != 0) {
-    _internal_set_image(from._internal_image());
-  }
-  if (from.version() != 0) {
-    _internal_set_version(from._internal_version());
-  }
-  if (from.number() != 0) {
-    _internal_set_number(from._internal_number());
-  }
-  if (from.checksum() != 0) {
-    _internal_set_checksum(from._internal_checksum());
-  }
-}
-
-void Chunk::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:recoverer.Chunk)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Chunk::CopyFrom(const Chunk& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:recoverer.Chunk)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Chunk::IsInitialized() const {
-  return true;
-}
-
-void Chunk::InternalSwap(Chunk* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  data_.Swap(&other->data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(image_, other->image_);
-  swap(version_, other->version_);
-  swap(number_, other->number_);
-  swap(checksum_, other->checksum_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Chunk::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-void ChunkList::InitAsDefaultInstance() {
-}
-class ChunkList::_Internal {
- public:
-};
-
-ChunkList::ChunkList()
-  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:recoverer.ChunkList)
-}
-ChunkList::ChunkList(const ChunkList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _internal_metadata_(nullptr),
-      needed_(from.needed_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:recoverer.ChunkList)
-}
-
-void ChunkList::SharedCtor() {
-}
-
-ChunkList::~ChunkList() {
-  // @@protoc_insertion_point(destructor:recoverer.ChunkList)
-  SharedDtor();
-}
-
-void ChunkList::SharedDtor() {
-}
-
-void ChunkList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ChunkList& ChunkList::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ChunkList_recover_5fservice_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void ChunkList::Clear() {
-// @@protoc_insertion_point(message_clear_start:recoverer.ChunkList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  needed_.Clear();
-  _internal_metadata_.Clear();
-}
-
-const char* ChunkList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // repeated int32 needed = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_needed(), ptr, ctx);
-          CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
-          _internal_add_needed(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* ChunkList::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:recoverer.ChunkList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated int32 needed = 1;
-  {
-    int byte_size = _needed_cached_byte_size_.load(std::memory_order_relaxed);
-    if (byte_size > 0) {
-      target = stream->WriteInt32Packed(
-          1, _internal_needed(), byte_size, target);
-    }
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields(), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:recoverer.ChunkList)
-  return target;
-}
-
-size_t ChunkList::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:recoverer.ChunkList)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated int32 needed = 1;
-  {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      Int32Size(this->needed_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
-    }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _needed_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
-    total_size += data_size;
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void ChunkList::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:recoverer.ChunkList)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ChunkList* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ChunkList>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:recoverer.ChunkList)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:recoverer.ChunkList)
-    MergeFrom(*source);
-  }
-}
-
-void ChunkList::MergeFrom(const ChunkList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:recoverer.ChunkList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  needed_.MergeFrom(from.needed_);
-}
-
-void ChunkList::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:recoverer.ChunkList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void ChunkList::CopyFrom(const ChunkList& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:recoverer.ChunkList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool ChunkList::IsInitialized() const {
-  return true;
-}
-
-void ChunkList::InternalSwap(ChunkList* other) {
-  using std::swap;
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-  needed_.InternalSwap(&other->needed_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata ChunkList::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace recoverer
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::recoverer::Version* Arena::CreateMaybeMessage< ::recoverer::Version >(Arena* arena) {
-  return Arena::CreateInternal< ::recoverer::Version >(arena);
-}
-template<> PROTOBUF_NOINLINE ::recoverer::Reply* Arena::CreateMaybeMessage< ::recoverer::Reply >(Arena* arena) {
-  return Arena::CreateInternal< ::recoverer::Reply >(arena);
-}
-template<> PROTOBUF_NOINLINE ::recoverer::Image* Arena::CreateMaybeMessage< ::recoverer::Image >(Arena* arena) {
-  return Arena::CreateInternal< ::recoverer::Image >(arena);
-}
-template<> PROTOBUF_NOINLINE ::recoverer::ImageAndServName* Arena::CreateMaybeMessage< ::recoverer::ImageAndServName >(Arena* arena) {
-  return Arena::CreateInternal< ::recoverer::ImageAndServName >(arena);
-}
-template<> PROTOBUF_NOINLINE ::recoverer::Chunk* Arena::CreateMaybeMessage< ::recoverer::Chunk >(Arena* arena) {
-  return Arena::CreateInternal< ::recoverer::Chunk >(arena);
-}
-template<> PROTOBUF_NOINLINE ::recoverer::ChunkList* Arena::CreateMaybeMessage< ::recoverer::ChunkList >(Arena* arena) {
-  return Arena::CreateInternal< ::recoverer::ChunkList >(arena);
-}
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-#include <google/protobuf/port_undef.inc>
@@ -1,1379 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: recover_service.proto
-
-#ifndef GOOGLE_PROTOBUF_INCLUDED_recover_5fservice_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_recover_5fservice_2eproto
-
-#include <limits>
-#include <string>
-
-#include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3011000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please update
-#error your headers.
-#endif
-#if 3011002 < PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/port_undef.inc>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/unknown_field_set.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_recover_5fservice_2eproto
-PROTOBUF_NAMESPACE_OPEN
-namespace internal {
-class AnyMetadata;
-}  // namespace internal
-PROTOBUF_NAMESPACE_CLOSE
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_recover_5fservice_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[6]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
-};
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_recover_5fservice_2eproto;
-namespace recoverer {
-class Chunk;
-class ChunkDefaultTypeInternal;
-extern ChunkDefaultTypeInternal _Chunk_default_instance_;
-class ChunkList;
-class ChunkListDefaultTypeInternal;
-extern ChunkListDefaultTypeInternal _ChunkList_default_instance_;
-class Image;
-class ImageDefaultTypeInternal;
-extern ImageDefaultTypeInternal _Image_default_instance_;
-class ImageAndServName;
-class ImageAndServNameDefaultTypeInternal;
-extern ImageAndServNameDefaultTypeInternal _ImageAndServName_default_instance_;
-class Reply;
-class ReplyDefaultTypeInternal;
-extern ReplyDefaultTypeInternal _Reply_default_instance_;
-class Version;
-class VersionDefaultTypeInternal;
-extern VersionDefaultTypeInternal _Version_default_instance_;
-}  // namespace recoverer
-PROTOBUF_NAMESPACE_OPEN
-template<> ::recoverer::Chunk* Arena::CreateMaybeMessage<::recoverer::Chunk>(Arena*);
-template<> ::recoverer::ChunkList* Arena::CreateMaybeMessage<::recoverer::ChunkList>(Arena*);
-template<> ::recoverer::Image* Arena::CreateMaybeMessage<::recoverer::Image>(Arena*);
-template<> ::recoverer::ImageAndServName* Arena::CreateMaybeMessage<::recoverer::ImageAndServName>(Arena*);
-template<> ::recoverer::Reply* Arena::CreateMaybeMessage<::recoverer::Reply>(Arena*);
-template<> ::recoverer::Version* Arena::CreateMaybeMessage<::recoverer::Version>(Arena*);
-PROTOBUF_NAMESPACE_CLOSE
-namespace recoverer {
-
-// ===================================================================
-
-class Version :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:recoverer.Version) */ {
- public:
-  Version();
-  virtual ~Version();
-
-  Version(const Version& from);
-  Version(Version&& from) noexcept
-    : Version() {
-    *this = ::std::move(from);
-  }
-
-  inline Version& operator=(const Version& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Version& operator=(Version&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Version& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Version* internal_default_instance() {
-    return reinterpret_cast<const Version*>(
-               &_Version_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  friend void swap(Version& a, Version& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Version* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Version* New() const final {
-    return CreateMaybeMessage<Version>(nullptr);
-  }
-
-  Version* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Version>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Version& from);
-  void MergeFrom(const Version& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Version* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "recoverer.Version";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_recover_5fservice_2eproto);
-    return ::descriptor_table_recover_5fservice_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kImageFieldNumber = 1,
-    kVersionFieldNumber = 2,
-    kSizeFieldNumber = 3,
-  };
-  // int32 image = 1;
-  void clear_image();
-  ::PROTOBUF_NAMESPACE_ID::int32 image() const;
-  void set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_image() const;
-  void _internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 version = 2;
-  void clear_version();
-  ::PROTOBUF_NAMESPACE_ID::int32 version() const;
-  void set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_version() const;
-  void _internal_set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 size = 3;
-  void clear_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 size() const;
-  void set_size(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_size() const;
-  void _internal_set_size(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:recoverer.Version)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int32 image_;
-  ::PROTOBUF_NAMESPACE_ID::int32 version_;
-  ::PROTOBUF_NAMESPACE_ID::int32 size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_recover_5fservice_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Reply :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:recoverer.Reply) */ {
- public:
-  Reply();
-  virtual ~Reply();
-
-  Reply(const Reply& from);
-  Reply(Reply&& from) noexcept
-    : Reply() {
-    *this = ::std::move(from);
-  }
-
-  inline Reply& operator=(const Reply& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Reply& operator=(Reply&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Reply& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Reply* internal_default_instance() {
-    return reinterpret_cast<const Reply*>(
-               &_Reply_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(Reply& a, Reply& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Reply* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Reply* New() const final {
-    return CreateMaybeMessage<Reply>(nullptr);
-  }
-
-  Reply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Reply>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Reply& from);
-  void MergeFrom(const Reply& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Reply* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "recoverer.Reply";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_recover_5fservice_2eproto);
-    return ::descriptor_table_recover_5fservice_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kStatusFieldNumber = 1,
-  };
-  // int32 status = 1;
-  void clear_status();
-  ::PROTOBUF_NAMESPACE_ID::int32 status() const;
-  void set_status(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_status() const;
-  void _internal_set_status(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:recoverer.Reply)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int32 status_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_recover_5fservice_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Image :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:recoverer.Image) */ {
- public:
-  Image();
-  virtual ~Image();
-
-  Image(const Image& from);
-  Image(Image&& from) noexcept
-    : Image() {
-    *this = ::std::move(from);
-  }
-
-  inline Image& operator=(const Image& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Image& operator=(Image&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Image& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Image* internal_default_instance() {
-    return reinterpret_cast<const Image*>(
-               &_Image_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  friend void swap(Image& a, Image& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Image* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Image* New() const final {
-    return CreateMaybeMessage<Image>(nullptr);
-  }
-
-  Image* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Image>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Image& from);
-  void MergeFrom(const Image& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Image* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "recoverer.Image";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_recover_5fservice_2eproto);
-    return ::descriptor_table_recover_5fservice_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kImageFieldNumber = 1,
-  };
-  // int32 image = 1;
-  void clear_image();
-  ::PROTOBUF_NAMESPACE_ID::int32 image() const;
-  void set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_image() const;
-  void _internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:recoverer.Image)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::int32 image_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_recover_5fservice_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ImageAndServName :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:recoverer.ImageAndServName) */ {
- public:
-  ImageAndServName();
-  virtual ~ImageAndServName();
-
-  ImageAndServName(const ImageAndServName& from);
-  ImageAndServName(ImageAndServName&& from) noexcept
-    : ImageAndServName() {
-    *this = ::std::move(from);
-  }
-
-  inline ImageAndServName& operator=(const ImageAndServName& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ImageAndServName& operator=(ImageAndServName&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ImageAndServName& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ImageAndServName* internal_default_instance() {
-    return reinterpret_cast<const ImageAndServName*>(
-               &_ImageAndServName_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    3;
-
-  friend void swap(ImageAndServName& a, ImageAndServName& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ImageAndServName* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ImageAndServName* New() const final {
-    return CreateMaybeMessage<ImageAndServName>(nullptr);
-  }
-
-  ImageAndServName* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ImageAndServName>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ImageAndServName& from);
-  void MergeFrom(const ImageAndServName& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ImageAndServName* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "recoverer.ImageAndServName";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_recover_5fservice_2eproto);
-    return ::descriptor_table_recover_5fservice_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kServnameFieldNumber = 2,
-    kImageFieldNumber = 1,
-  };
-  // string servname = 2;
-  void clear_servname();
-  const std::string& servname() const;
-  void set_servname(const std::string& value);
-  void set_servname(std::string&& value);
-  void set_servname(const char* value);
-  void set_servname(const char* value, size_t size);
-  std::string* mutable_servname();
-  std::string* release_servname();
-  void set_allocated_servname(std::string* servname);
-  private:
-  const std::string& _internal_servname() const;
-  void _internal_set_servname(const std::string& value);
-  std::string* _internal_mutable_servname();
-  public:
-
-  // int32 image = 1;
-  void clear_image();
-  ::PROTOBUF_NAMESPACE_ID::int32 image() const;
-  void set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_image() const;
-  void _internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:recoverer.ImageAndServName)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr servname_;
-  ::PROTOBUF_NAMESPACE_ID::int32 image_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_recover_5fservice_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Chunk :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:recoverer.Chunk) */ {
- public:
-  Chunk();
-  virtual ~Chunk();
-
-  Chunk(const Chunk& from);
-  Chunk(Chunk&& from) noexcept
-    : Chunk() {
-    *this = ::std::move(from);
-  }
-
-  inline Chunk& operator=(const Chunk& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Chunk& operator=(Chunk&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Chunk& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Chunk* internal_default_instance() {
-    return reinterpret_cast<const Chunk*>(
-               &_Chunk_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    4;
-
-  friend void swap(Chunk& a, Chunk& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Chunk* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Chunk* New() const final {
-    return CreateMaybeMessage<Chunk>(nullptr);
-  }
-
-  Chunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Chunk>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Chunk& from);
-  void MergeFrom(const Chunk& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Chunk* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "recoverer.Chunk";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_recover_5fservice_2eproto);
-    return ::descriptor_table_recover_5fservice_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kDataFieldNumber = 4,
-    kImageFieldNumber = 1,
-    kVersionFieldNumber = 2,
-    kNumberFieldNumber = 3,
-    kChecksumFieldNumber = 5,
-  };
-  // bytes data = 4;
-  void clear_data();
-  const std::string& data() const;
-  void set_data(const std::string& value);
-  void set_data(std::string&& value);
-  void set_data(const char* value);
-  void set_data(const void* value, size_t size);
-  std::string* mutable_data();
-  std::string* release_data();
-  void set_allocated_data(std::string* data);
-  private:
-  const std::string& _internal_data() const;
-  void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
-  public:
-
-  // int32 image = 1;
-  void clear_image();
-  ::PROTOBUF_NAMESPACE_ID::int32 image() const;
-  void set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_image() const;
-  void _internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 version = 2;
-  void clear_version();
-  ::PROTOBUF_NAMESPACE_ID::int32 version() const;
-  void set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_version() const;
-  void _internal_set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 number = 3;
-  void clear_number();
-  ::PROTOBUF_NAMESPACE_ID::int32 number() const;
-  void set_number(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_number() const;
-  void _internal_set_number(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // int32 checksum = 5;
-  void clear_checksum();
-  ::PROTOBUF_NAMESPACE_ID::int32 checksum() const;
-  void set_checksum(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_checksum() const;
-  void _internal_set_checksum(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:recoverer.Chunk)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  ::PROTOBUF_NAMESPACE_ID::int32 image_;
-  ::PROTOBUF_NAMESPACE_ID::int32 version_;
-  ::PROTOBUF_NAMESPACE_ID::int32 number_;
-  ::PROTOBUF_NAMESPACE_ID::int32 checksum_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_recover_5fservice_2eproto;
-};
-// -------------------------------------------------------------------
-
-class ChunkList :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:recoverer.ChunkList) */ {
- public:
-  ChunkList();
-  virtual ~ChunkList();
-
-  ChunkList(const ChunkList& from);
-  ChunkList(ChunkList&& from) noexcept
-    : ChunkList() {
-    *this = ::std::move(from);
-  }
-
-  inline ChunkList& operator=(const ChunkList& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline ChunkList& operator=(ChunkList&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const ChunkList& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ChunkList* internal_default_instance() {
-    return reinterpret_cast<const ChunkList*>(
-               &_ChunkList_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    5;
-
-  friend void swap(ChunkList& a, ChunkList& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(ChunkList* other) {
-    if (other == this) return;
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline ChunkList* New() const final {
-    return CreateMaybeMessage<ChunkList>(nullptr);
-  }
-
-  ChunkList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ChunkList>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ChunkList& from);
-  void MergeFrom(const ChunkList& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(ChunkList* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "recoverer.ChunkList";
-  }
-  private:
-  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
-    return nullptr;
-  }
-  inline void* MaybeArenaPtr() const {
-    return nullptr;
-  }
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_recover_5fservice_2eproto);
-    return ::descriptor_table_recover_5fservice_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kNeededFieldNumber = 1,
-  };
-  // repeated int32 needed = 1;
-  int needed_size() const;
-  private:
-  int _internal_needed_size() const;
-  public:
-  void clear_needed();
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_needed(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-      _internal_needed() const;
-  void _internal_add_needed(::PROTOBUF_NAMESPACE_ID::int32 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-      _internal_mutable_needed();
-  public:
-  ::PROTOBUF_NAMESPACE_ID::int32 needed(int index) const;
-  void set_needed(int index, ::PROTOBUF_NAMESPACE_ID::int32 value);
-  void add_needed(::PROTOBUF_NAMESPACE_ID::int32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-      needed() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-      mutable_needed();
-
-  // @@protoc_insertion_point(class_scope:recoverer.ChunkList)
- private:
-  class _Internal;
-
-  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 > needed_;
-  mutable std::atomic<int> _needed_cached_byte_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_recover_5fservice_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Version
-
-// int32 image = 1;
-inline void Version::clear_image() {
-  image_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Version::_internal_image() const {
-  return image_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Version::image() const {
-  // @@protoc_insertion_point(field_get:recoverer.Version.image)
-  return _internal_image();
-}
-inline void Version::_internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  image_ = value;
-}
-inline void Version::set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_image(value);
-  // @@protoc_insertion_point(field_set:recoverer.Version.image)
-}
-
-// int32 version = 2;
-inline void Version::clear_version() {
-  version_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Version::_internal_version() const {
-  return version_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Version::version() const {
-  // @@protoc_insertion_point(field_get:recoverer.Version.version)
-  return _internal_version();
-}
-inline void Version::_internal_set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  version_ = value;
-}
-inline void Version::set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:recoverer.Version.version)
-}
-
-// int32 size = 3;
-inline void Version::clear_size() {
-  size_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Version::_internal_size() const {
-  return size_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Version::size() const {
-  // @@protoc_insertion_point(field_get:recoverer.Version.size)
-  return _internal_size();
-}
-inline void Version::_internal_set_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  size_ = value;
-}
-inline void Version::set_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_size(value);
-  // @@protoc_insertion_point(field_set:recoverer.Version.size)
-}
-
-// -------------------------------------------------------------------
-
-// Reply
-
-// int32 status = 1;
-inline void Reply::clear_status() {
-  status_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Reply::_internal_status() const {
-  return status_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Reply::status() const {
-  // @@protoc_insertion_point(field_get:recoverer.Reply.status)
-  return _internal_status();
-}
-inline void Reply::_internal_set_status(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  status_ = value;
-}
-inline void Reply::set_status(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:recoverer.Reply.status)
-}
-
-// -------------------------------------------------------------------
-
-// Image
-
-// int32 image = 1;
-inline void Image::clear_image() {
-  image_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Image::_internal_image() const {
-  return image_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Image::image() const {
-  // @@protoc_insertion_point(field_get:recoverer.Image.image)
-  return _internal_image();
-}
-inline void Image::_internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  image_ = value;
-}
-inline void Image::set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_image(value);
-  // @@protoc_insertion_point(field_set:recoverer.Image.image)
-}
-
-// -------------------------------------------------------------------
-
-// ImageAndServName
-
-// int32 image = 1;
-inline void ImageAndServName::clear_image() {
-  image_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ImageAndServName::_internal_image() const {
-  return image_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ImageAndServName::image() const {
-  // @@protoc_insertion_point(field_get:recoverer.ImageAndServName.image)
-  return _internal_image();
-}
-inline void ImageAndServName::_internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  image_ = value;
-}
-inline void ImageAndServName::set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_image(value);
-  // @@protoc_insertion_point(field_set:recoverer.ImageAndServName.image)
-}
-
-// string servname = 2;
-inline void ImageAndServName::clear_servname() {
-  servname_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& ImageAndServName::servname() const {
-  // @@protoc_insertion_point(field_get:recoverer.ImageAndServName.servname)
-  return _internal_servname();
-}
-inline void ImageAndServName::set_servname(const std::string& value) {
-  _internal_set_servname(value);
-  // @@protoc_insertion_point(field_set:recoverer.ImageAndServName.servname)
-}
-inline std::string* ImageAndServName::mutable_servname() {
-  // @@protoc_insertion_point(field_mutable:recoverer.ImageAndServName.servname)
-  return _internal_mutable_servname();
-}
-inline const std::string& ImageAndServName::_internal_servname() const {
-  return servname_.GetNoArena();
-}
-inline void ImageAndServName::_internal_set_servname(const std::string& value) {
-  
-  servname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void ImageAndServName::set_servname(std::string&& value) {
-  
-  servname_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:recoverer.ImageAndServName.servname)
-}
-inline void ImageAndServName::set_servname(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  servname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:recoverer.ImageAndServName.servname)
-}
-inline void ImageAndServName::set_servname(const char* value, size_t size) {
-  
-  servname_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:recoverer.ImageAndServName.servname)
-}
-inline std::string* ImageAndServName::_internal_mutable_servname() {
-  
-  return servname_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* ImageAndServName::release_servname() {
-  // @@protoc_insertion_point(field_release:recoverer.ImageAndServName.servname)
-  
-  return servname_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void ImageAndServName::set_allocated_servname(std::string* servname) {
-  if (servname != nullptr) {
-    
-  } else {
-    
-  }
-  servname_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), servname);
-  // @@protoc_insertion_point(field_set_allocated:recoverer.ImageAndServName.servname)
-}
-
-// -------------------------------------------------------------------
-
-// Chunk
-
-// int32 image = 1;
-inline void Chunk::clear_image() {
-  image_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::_internal_image() const {
-  return image_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::image() const {
-  // @@protoc_insertion_point(field_get:recoverer.Chunk.image)
-  return _internal_image();
-}
-inline void Chunk::_internal_set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  image_ = value;
-}
-inline void Chunk::set_image(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_image(value);
-  // @@protoc_insertion_point(field_set:recoverer.Chunk.image)
-}
-
-// int32 version = 2;
-inline void Chunk::clear_version() {
-  version_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::_internal_version() const {
-  return version_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::version() const {
-  // @@protoc_insertion_point(field_get:recoverer.Chunk.version)
-  return _internal_version();
-}
-inline void Chunk::_internal_set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  version_ = value;
-}
-inline void Chunk::set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_version(value);
-  // @@protoc_insertion_point(field_set:recoverer.Chunk.version)
-}
-
-// int32 number = 3;
-inline void Chunk::clear_number() {
-  number_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::_internal_number() const {
-  return number_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::number() const {
-  // @@protoc_insertion_point(field_get:recoverer.Chunk.number)
-  return _internal_number();
-}
-inline void Chunk::_internal_set_number(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  number_ = value;
-}
-inline void Chunk::set_number(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_number(value);
-  // @@protoc_insertion_point(field_set:recoverer.Chunk.number)
-}
-
-// bytes data = 4;
-inline void Chunk::clear_data() {
-  data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline const std::string& Chunk::data() const {
-  // @@protoc_insertion_point(field_get:recoverer.Chunk.data)
-  return _internal_data();
-}
-inline void Chunk::set_data(const std::string& value) {
-  _internal_set_data(value);
-  // @@protoc_insertion_point(field_set:recoverer.Chunk.data)
-}
-inline std::string* Chunk::mutable_data() {
-  // @@protoc_insertion_point(field_mutable:recoverer.Chunk.data)
-  return _internal_mutable_data();
-}
-inline const std::string& Chunk::_internal_data() const {
-  return data_.GetNoArena();
-}
-inline void Chunk::_internal_set_data(const std::string& value) {
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
-}
-inline void Chunk::set_data(std::string&& value) {
-  
-  data_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:recoverer.Chunk.data)
-}
-inline void Chunk::set_data(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:recoverer.Chunk.data)
-}
-inline void Chunk::set_data(const void* value, size_t size) {
-  
-  data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:recoverer.Chunk.data)
-}
-inline std::string* Chunk::_internal_mutable_data() {
-  
-  return data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline std::string* Chunk::release_data() {
-  // @@protoc_insertion_point(field_release:recoverer.Chunk.data)
-  
-  return data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-inline void Chunk::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
-    
-  } else {
-    
-  }
-  data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data);
-  // @@protoc_insertion_point(field_set_allocated:recoverer.Chunk.data)
-}
-
-// int32 checksum = 5;
-inline void Chunk::clear_checksum() {
-  checksum_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::_internal_checksum() const {
-  return checksum_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Chunk::checksum() const {
-  // @@protoc_insertion_point(field_get:recoverer.Chunk.checksum)
-  return _internal_checksum();
-}
-inline void Chunk::_internal_set_checksum(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  checksum_ = value;
-}
-inline void Chunk::set_checksum(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_checksum(value);
-  // @@protoc_insertion_point(field_set:recoverer.Chunk.checksum)
-}
-
-// -------------------------------------------------------------------
-
-// ChunkList
-
-// repeated int32 needed = 1;
-inline int ChunkList::_internal_needed_size() const {
-  return needed_.size();
-}
-inline int ChunkList::needed_size() const {
-  return _internal_needed_size();
-}
-inline void ChunkList::clear_needed() {
-  needed_.Clear();
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ChunkList::_internal_needed(int index) const {
-  return needed_.Get(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 ChunkList::needed(int index) const {
-  // @@protoc_insertion_point(field_get:recoverer.ChunkList.needed)
-  return _internal_needed(index);
-}
-inline void ChunkList::set_needed(int index, ::PROTOBUF_NAMESPACE_ID::int32 value) {
-  needed_.Set(index, value);
-  // @@protoc_insertion_point(field_set:recoverer.ChunkList.needed)
-}
-inline void ChunkList::_internal_add_needed(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  needed_.Add(value);
-}
-inline void ChunkList::add_needed(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_add_needed(value);
-  // @@protoc_insertion_point(field_add:recoverer.ChunkList.needed)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-ChunkList::_internal_needed() const {
-  return needed_;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >&
-ChunkList::needed() const {
-  // @@protoc_insertion_point(field_list:recoverer.ChunkList.needed)
-  return _internal_needed();
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-ChunkList::_internal_mutable_needed() {
-  return &needed_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int32 >*
-ChunkList::mutable_needed() {
-  // @@protoc_insertion_point(field_mutable_list:recoverer.ChunkList.needed)
-  return _internal_mutable_needed();
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace recoverer
-
-// @@protoc_insertion_point(global_scope)
-
-#include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_recover_5fservice_2eproto
@@ -6,194 +6,1865 @@
 #include <grpcpp/grpcpp.h>
 #include <grpcpp/support/status.h>
 #include <grpcpp/server_context.h>
+#include <zlib.h>
 #include "recover_service.pb.h"
 #include "recover_service.grpc.pb.h"
+#include "launcher.h"
+#include "docker_client.h"
+#include "bspatch.h"
+#include "arena_allocator.h"
 #include <vector>
 #include <set>
+#include <map>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#include <climits>
+#include <sys/uio.h>
+#include <sys/sysmacros.h>
+#include <ftw.h>
 
-void executeCMD(const char *cmd)
-{
-    std::cerr<<cmd<<std::endl;
-    char* buf_ps=new char[1024];
-    char* result=new char[65536];
-    buf_ps[0]=0;
-    result[0]=0;
-    char ps[1024]={0};
-    FILE *ptr;
-    strcpy(ps, cmd);
-    if((ptr=popen(ps, "r"))!=NULL)
+using grpc::Server;
+using grpc::ServerBuilder;
+using grpc::ServerContext;
+using grpc::Status;
+using namespace recoverer;
+
+class svImpl final:public recover_service::WithCallbackMethod_Chunk2Send<recover_service::WithCallbackMethod_PushVersion<
+                          recover_service::WithRawCallbackMethod_SendChunk<recover_service::Service>>>{
+public:
+    svImpl() {
+        SetMessageAllocatorFor_Chunk2Send(&listAllocator);
+        SetMessageAllocatorFor_PushVersion(&pushAllocator);
+    }
+
+private:
+    ArenaAllocator<Image, ChunkList> listAllocator{16*1024};    //Room for a few hundred missing runs
+    ArenaAllocator<InlineVersion, Reply> pushAllocator{64*1024};
+
+    Status TellVersion(ServerContext* context, const Version* request, Reply* response) override;
+    grpc::ServerUnaryReactor* Chunk2Send(grpc::CallbackServerContext* context, const Image* request,
+                                         ChunkList* response) override;
+    grpc::ServerUnaryReactor* SendChunk(grpc::CallbackServerContext* context, const grpc::ByteBuffer* request,
+                                        grpc::ByteBuffer* response) override;
+    grpc::ServerUnaryReactor* PushVersion(grpc::CallbackServerContext* context, const InlineVersion* request,
+                                          Reply* response) override;
+    Status GetVersion(ServerContext* context, const Image* request, VersionState* response) override;
+    Status KeepAlive(ServerContext* context, const Reply* request, Reply* response) override;
+    Status RecoverServ(ServerContext* context, const ImageAndServName* request, RecoverJob* response) override;
+    Status RecoverStatus(ServerContext* context, const RecoverJob* request, RecoverJobStatus* response) override;
+};
+
+const int maxImages=64;
+std::vector<int> images;        //Version of the current (or last) transfer
+std::vector<int> steps;         //1 receiving, 2 patching, 3 done
+std::vector<int> applied;       //Latest complete version, -1 for none
+std::vector<int> imageOf;       //Version whose img file the applied one is made of: itself, or
+                                //the full image a run of change sets builds on
+std::vector<int> bases;         //Base of the current transfer, -1 for a full image
+std::vector<int> changesets;    //The current transfer is an upperdir change set, not a bsdiff patch
+std::vector<int64_t> sizes;     //Size of the current transfer
+std::vector<bool> logging;      //The current transfer goes to a chunk log (see chunkLog)
+
+//Chunk size is chosen by the controller per version, within these bounds.
+const int64_t defaultChunkSize=1024*1024;
+const int64_t maxChunkSize=16*1024*1024;
+std::vector<int64_t> chunkSizes;
+
+//Chunks still missing for the version being received, as disjoint [first, end)
+//runs keyed by first, so both a fresh and a nearly complete image stay small.
+struct ChunkRanges {
+    std::map<int64_t, int64_t> runs;
+    int64_t count=0;
+
+    void reset(int64_t n) {
+        runs.clear();
+        count=n;
+        if (n>0) runs[0]=n;
+    }
+
+    //Removes chunk c; returns false if it was not missing.
+    bool take(int64_t c) {
+        auto it=runs.upper_bound(c);
+        if (it==runs.begin()) return false;
+        --it;
+        int64_t first=it->first, end=it->second;
+        if (c>=end) return false;
+        runs.erase(it);
+        if (first<c) runs[first]=c;
+        if (c+1<end) runs[c+1]=end;
+        count--;
+        return true;
+    }
+
+    bool missing(int64_t c) const {
+        auto it=runs.upper_bound(c);
+        if (it==runs.begin()) return false;
+        --it;
+        return c<it->second;
+    }
+
+    //Marks chunk c missing again, merging it with neighbouring runs.
+    void put(int64_t c) {
+        auto next=runs.upper_bound(c);
+        int64_t first=c, end=c+1;
+        if (next!=runs.begin()) {
+            auto prev=std::prev(next);
+            if (c<prev->second) return;
+            if (prev->second==c) {
+                first=prev->first;
+                runs.erase(prev);
+            }
+        }
+        if (next!=runs.end() && next->first==end) {
+            end=next->second;
+            runs.erase(next);
+        }
+        runs[first]=end;
+        count++;
+    }
+};
+std::vector<ChunkRanges> chunkTable;
+std::vector<FILE*> fileP;
+
+//The replication state of an image (its entries in these tables, its transfer file and
+//write-behind buffer) is only touched under its lock: RPCs for it may come on several
+//threads, and flushLoop writes out its buffer on one of its own. Syncing and patching
+//run on threads of their own too (see SendChunk), one at a time per image under its
+//sync lock, and hold the image lock only around the state they read and change: while
+//steps is 2 the transfer is theirs, and nothing else writes its file.
+std::vector<std::mutex> imageLocks(maxImages);
+std::vector<std::mutex> syncLocks(maxImages);
+std::vector<int64_t> transferSerial;    //Bumped as a transfer starts, so late work can tell it is stale
+
+//Restores run in background threads; RecoverServ only hands out a job id.
+struct JobInfo {
+    int image;
+    int version;
+    int64_t failure;                          //The master's id of the failure it recovers from
+    RecoverPhase phase;
+    std::chrono::steady_clock::time_point start, end;
+    std::string container;
+    std::vector<std::pair<int, int>> ports;   //(container port, host port)
+};
+std::mutex jobMutex;
+std::map<int, JobInfo> jobs;
+std::map<int, int> activeJob;   //Image -> its latest job, so a retried RecoverServ is not run twice
+int nextJob=1;
+
+void setPhase(int job, RecoverPhase phase) {
+    std::lock_guard<std::mutex> lk(jobMutex);
+    jobs[job].phase=phase;
+    if (phase==READY || phase==FAILED) jobs[job].end=std::chrono::steady_clock::now();
+}
+
+//Every complete version is imported into the local docker store in the background
+//and tagged standby<image>:<version>, so a failover only has to start a container.
+//Change sets leave the image as it is: its ready tag stays, and only standbys are
+//rebuilt with the new upper_<image#>.
+std::mutex preloadMutex;
+std::map<int, int> readyImage;       //Image -> version of the img file behind its ready tag
+std::map<int, int> readyVersion;     //Image -> version the ready tag and standby were brought to
+std::map<int, bool> preloading;      //Image -> a preload thread is running
+std::set<int> staleReady;            //Images whose img file a full version replaced under the same version
+DockerClient docker;
+
+//How each image is run: from the config file, overridden by what the master sends with
+//RecoverServ. Every image gets its own container name and host ports, so several services
+//can be restored on one node at once.
+struct ServSpec {
+    std::string name;            //Container name is <name>-<image#>
+    std::string imageName;       //Repository of the ready tags, or the one a restore runs as
+    std::vector<int> ports;      //Container ports to publish
+    std::string command;
+};
+std::map<int, ServSpec> servSpecs;
+int portLow=4000, portHigh=4999;
+
+std::mutex allocMutex;
+std::set<int> usedPorts;
+std::map<int, std::vector<std::pair<int, int>>> portMaps;   //Image -> (container port, host port)
+
+ServSpec specOf(int img) {
+    ServSpec spec;
+    auto it=servSpecs.find(img);
+    if (it!=servSpecs.end()) spec=it->second;
+    if (spec.name.empty()) spec.name="serv";
+    if (spec.imageName.empty()) spec.imageName="standby"+std::to_string(img);
+    if (spec.ports.empty()) spec.ports.push_back(8000);
+    if (spec.command.empty()) spec.command="manage.py runserver 0.0.0.0:8000";
+    return spec;
+}
+
+std::string containerName(int img, const ServSpec &spec) {
+    return spec.name+"-"+std::to_string(img);
+}
+
+std::string readyTag(int img, int vN) {
+    return specOf(img).imageName+":"+std::to_string(vN);
+}
+
+bool portFree(int port) {
+    int fd=socket(AF_INET, SOCK_STREAM, 0);
+    if (fd<0) return false;
+    sockaddr_in addr={};
+    addr.sin_family=AF_INET;
+    addr.sin_addr.s_addr=htonl(INADDR_ANY);
+    addr.sin_port=htons(port);
+    bool ok=bind(fd, (sockaddr*)&addr, sizeof(addr))==0;
+    close(fd);
+    return ok;
+}
+
+//Returns the host ports for img, reusing the ones it already holds and allocating
+//the rest from [portLow, portHigh]; empty if the range is exhausted. Ports it held
+//for container ports no longer asked for are given back.
+std::vector<std::pair<int, int>> allocPorts(int img, const std::vector<int> &ports) {
+    std::lock_guard<std::mutex> lk(allocMutex);
+    auto &held=portMaps[img];
+    for (auto m=held.begin(); m!=held.end(); ) {
+        if (std::find(ports.begin(), ports.end(), m->first)!=ports.end()) m++;
+        else {
+            usedPorts.erase(m->second);
+            m=held.erase(m);
+        }
+    }
+    std::vector<std::pair<int, int>> result;
+    for (int cp:ports) {
+        int hp=-1;
+        for (auto &m:held)
+            if (m.first==cp) hp=m.second;
+        for (int p=portLow; hp==-1 && p<=portHigh; p++)
+            if (usedPorts.count(p)==0 && portFree(p)) {
+                hp=p;
+                usedPorts.insert(p);
+                held.push_back({cp, p});
+            }
+        if (hp==-1) {
+            std::cout<<"No free host port left for Image#"<<img<<"\n";
+            return {};
+        }
+        result.push_back({cp, hp});
+    }
+    return result;
+}
+
+//Gives back the host ports of img once no container of it is left.
+void releasePorts(int img) {
+    std::lock_guard<std::mutex> lk(allocMutex);
+    for (auto &m:portMaps[img]) usedPorts.erase(m.second);
+    portMaps.erase(img);
+}
+
+//What docker run/create is given: name, limits, published ports, image and command.
+ContainerSpec containerSpec(int img, const std::string &image, const ServSpec &spec,
+                            const std::vector<std::pair<int, int>> &ports, int memMB) {
+    ContainerSpec c;
+    c.name=containerName(img, spec);
+    c.image=image;
+    c.cmd=splitWords(spec.command);
+    c.ports=ports;
+    c.memMB=memMB;
+    return c;
+}
+
+//The change sets applied since the last full image live in upper_<image#>, laid out as an
+//overlay upperdir on top of that image. A container gets a copy before it first starts.
+std::mutex upperMutex;
+
+std::string upperDir(int img) {
+    return "upper_"+std::to_string(img);
+}
+
+//Copies the change sets of img into the upperdir of container name, created but not started.
+bool populateUpper(int img, const std::string &name) {
+    std::lock_guard<std::mutex> lk(upperMutex);
+    if (access(upperDir(img).c_str(), F_OK)!=0) return true;
+    std::string upper;
+    if (!dockerOK(docker.inspectContainer(name, nullptr, &upper), "inspect", name)) return false;
+    if (upper.empty()) {
+        std::cout<<name<<" has no overlay upperdir to take the changes of Image#"<<img<<"\n";
+        return false;
+    }
+    return executeCMD({"cp", "-a", "--reflink=auto", upperDir(img)+"/.", upper+"/"})==0;
+}
+
+//Optionally a standby container is kept per image on top of the ready tag: either
+//created (costs no memory, needs a start on failover) or started and paused (holds
+//its memory, needs only an unpause). Paused standbys share memBudgetMB.
+enum WarmMode {WARM_NONE=0, WARM_CREATED, WARM_PAUSED};
+struct StandbyConf {
+    WarmMode mode;
+    int memMB;
+};
+struct Standby {
+    WarmMode mode;
+    int version;
+};
+std::map<int, StandbyConf> standbyConf;   //From the config file
+std::map<int, Standby> standbys;          //What currently exists, guarded by preloadMutex
+int memBudgetMB=0;
+
+//Returns the version of img whose image is already in the docker store, or -1.
+int preloadedImage(int img) {
+    std::lock_guard<std::mutex> lk(preloadMutex);
+    auto it=readyImage.find(img);
+    return it==readyImage.end()?-1:it->second;
+}
+
+//Returns the version of img the preload last got through, or -1.
+int preloadedVersion(int img) {
+    std::lock_guard<std::mutex> lk(preloadMutex);
+    auto it=readyVersion.find(img);
+    return it==readyVersion.end()?-1:it->second;
+}
+
+//Loads img_<img>_<vN> and moves the ready tag onto it; returns false if docker failed.
+//Unless reuse is off, an image already under the ready tag is kept.
+bool importVersion(int img, int vN, bool reuse=true) {
+    std::string tag=readyTag(img, vN);
+    //Already in the store, e.g. imported before this recoverer restarted
+    if (reuse && docker.inspectImage(tag).ok()) return true;
+    std::string filename="img_"+std::to_string(img)+"_"+std::to_string(vN);
+    int fd=open(filename.c_str(), O_RDONLY);
+    if (fd<0) {
+        std::cout<<"Cannot open "<<filename<<"\n";
+        return false;
+    }
+    //The tar goes straight from the file into the daemon
+    std::string loaded;
+    struct stat st;
+    fstat(fd, &st);
+    DockerStatus status=docker.load(fd, st.st_size, &loaded);
+    close(fd);
+    if (!dockerOK(status, "load", filename)) return false;
+    //"name:tag", or "sha256:..." for untagged saves
+    if (loaded.empty()) {
+        std::cout<<"docker load "<<filename<<" reported no image\n";
+        return false;
+    }
+    if (loaded==tag) return true;
+    size_t colon=tag.rfind(':');
+    if (!dockerOK(docker.tag(loaded, tag.substr(0, colon), tag.substr(colon+1)), "tag", loaded)) return false;
+    //Keep only the ready tag; the image itself stays referenced by it
+    if (loaded.compare(0, 7, "sha256:")!=0) dockerOK(docker.removeImage(loaded), "rmi", loaded);
+    return true;
+}
+
+//Replaces the standby container of img with one of version vN: the ready tag of its
+//image, imageV, with the current upper_<img> on top.
+void refreshStandby(int img, int vN, int imageV) {
+    auto conf=standbyConf.find(img);
+    if (conf==standbyConf.end() || conf->second.mode==WARM_NONE) return;
+    {
+        //Once a recovery owns the standby it is the live service, leave it alone
+        std::lock_guard<std::mutex> lk(jobMutex);
+        auto it=activeJob.find(img);
+        if (it!=activeJob.end() && jobs[it->second].phase!=FAILED) return;
+    }
+
+    WarmMode mode=conf->second.mode;
+    if (mode==WARM_PAUSED) {
+        std::lock_guard<std::mutex> lk(preloadMutex);
+        int used=0;
+        for (auto &s:standbys)
+            if (s.first!=img && s.second.mode==WARM_PAUSED) used+=standbyConf[s.first].memMB;
+        if (used+conf->second.memMB>memBudgetMB) {
+            std::cout<<"Memory budget exhausted, keeping a created standby for Image#"<<img<<"\n";
+            mode=WARM_CREATED;
+        }
+    }
+
+    ServSpec spec=specOf(img);
+    std::string name=containerName(img, spec);
+    docker.removeContainer(name);
     {
-        while(fgets(buf_ps, 1024, ptr)!=NULL)
+        std::lock_guard<std::mutex> lk(preloadMutex);
+        standbys.erase(img);
+    }
+    auto ports=allocPorts(img, spec.ports);
+    bool ok=!ports.empty() && dockerOK(docker.create(containerSpec(img, readyTag(img, imageV), spec, ports, conf->second.memMB)), "create", name)
+            && populateUpper(img, name);
+    if (ok && mode==WARM_PAUSED) ok=dockerOK(docker.start(name), "start", name) && dockerOK(docker.pause(name), "pause", name);
+    if (!ok) {
+        docker.removeContainer(name);
+        releasePorts(img);
+        return;
+    }
+    std::cout<<"Standby for Image#"<<img<<" is at Version#"<<vN<<" ("<<(mode==WARM_PAUSED?"paused":"created")<<")\n\n";
+    std::lock_guard<std::mutex> lk(preloadMutex);
+    standbys[img]={mode, vN};
+}
+
+void preloadLoop(int img) {
+    while (1) {
+        int vN, imageV;
         {
-            strcat(result, buf_ps);
-            if(strlen(result)>65536)
-                break;
+            std::lock_guard<std::mutex> lk(imageLocks[img]);
+            vN=applied[img];
+            imageV=imageOf[img];
+        }
+        int old=preloadedImage(img);
+        bool stale;
+        {
+            std::lock_guard<std::mutex> lk(preloadMutex);
+            stale=staleReady.erase(img)>0;
+        }
+        if (vN==preloadedVersion(img) && imageV==old && !stale) break;
+        if (imageV!=old || stale) {
+            std::cout<<"Preloading Image#"<<img<<", Version#"<<vN<<"\n\n";
+            auto start=std::chrono::steady_clock::now();
+            //A replaced file is loaded again, the ready tag moving off the image it had
+            if (!importVersion(img, imageV, !stale)) {
+                if (stale) {
+                    std::lock_guard<std::mutex> lk(preloadMutex);
+                    staleReady.insert(img);
+                }
+                //The file may have been replaced by a newer version meanwhile; retry with that
+                std::lock_guard<std::mutex> lk(imageLocks[img]);
+                if (imageOf[img]==imageV) break;
+                continue;
+            }
+            auto ms=std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now()-start).count();
+            std::cout<<"Image#"<<img<<", Version#"<<vN<<" is ready as "<<readyTag(img, imageV)<<" ("<<ms<<"ms)\n\n";
+        }
+        else std::cout<<"Image#"<<img<<", Version#"<<vN<<" only changed "<<upperDir(img)<<", keeping "
+                      <<readyTag(img, imageV)<<"\n\n";
+        {
+            std::lock_guard<std::mutex> lk(preloadMutex);
+            readyImage[img]=imageV;
+            readyVersion[img]=vN;
         }
-        pclose(ptr);
-        ptr = NULL;
-        std::cout<<result;
+        refreshStandby(img, vN, imageV);
+        if (old>=0 && old!=imageV) dockerOK(docker.removeImage(readyTag(img, old)), "rmi", readyTag(img, old));
+    }
+    std::lock_guard<std::mutex> lk(preloadMutex);
+    preloading[img]=false;
+}
+
+void schedulePreload(int img) {
+    std::lock_guard<std::mutex> lk(preloadMutex);
+    if (preloading[img]) return;    //The running thread picks up the new version when done
+    preloading[img]=true;
+    std::thread(preloadLoop, img).detach();
+}
+
+//Gives up on a restore: nothing of it is left running, nor holding ports.
+void failRestore(int job, int img, const std::string &name) {
+    docker.removeContainer(name);
+    releasePorts(img);
+    setPhase(job, FAILED);
+}
+
+//Restores version vN of img, made of the img file of version imageV and upper_<img>.
+void recoverTheService(int job, int img, int vN, int imageV, ServSpec spec){
+    std::string name=containerName(img, spec);
+    ServSpec conf=specOf(img);
+    std::string standbyName=containerName(img, conf);
+    auto ports=allocPorts(img, spec.ports);
+    if (ports.empty()) {
+        docker.removeContainer(standbyName);
+        failRestore(job, img, name);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lk(jobMutex);
+        jobs[job].container=name;
+        jobs[job].ports=ports;
     }
-    else
+
+    Standby standby={WARM_NONE, -1};
     {
-        printf("popen %s error\n", ps);
+        std::lock_guard<std::mutex> lk(preloadMutex);
+        auto it=standbys.find(img);
+        if (it!=standbys.end()) {
+            standby=it->second;
+            //From now on the container is the live service, not a standby
+            standbys.erase(it);
+        }
     }
-    delete[] buf_ps;
-    delete[] result;
+    //The image runs under the name the master asked for, if any, as well as the ready tag
+    std::string image=readyTag(img, imageV);
+    if (spec.imageName!=conf.imageName) {
+        if (preloadedImage(img)==imageV
+            && !dockerOK(docker.tag(image, spec.imageName, std::to_string(vN)), "tag", image)) {
+            failRestore(job, img, name);
+            return;
+        }
+        image=spec.imageName+":"+std::to_string(vN);
+    }
+    //A standby can only be used when the request did not ask for other ports or command;
+    //it is renamed if the master named the service differently
+    bool sameSpec=spec.ports==conf.ports && spec.command==conf.command;
+    if (standby.mode!=WARM_NONE && standby.version==vN && sameSpec
+        && (standbyName==name || dockerOK(docker.rename(standbyName, name), "rename", standbyName))) {
+        setPhase(job, STARTING);
+        std::cout<<"Waking standby: Image#"<<img<<", Version#"<<vN<<" as "<<name<<"\n\n";
+        bool paused=standby.mode==WARM_PAUSED;
+        if (dockerOK(paused?docker.unpause(name):docker.start(name), paused?"unpause":"start", name)) {
+            setPhase(job, READY);
+            return;
+        }
+    }
+    //Clear an outdated standby or a container left by an earlier failed attempt
+    docker.removeContainer(standbyName);
+    docker.removeContainer(name);
+
+    if (preloadedImage(img)!=imageV) {
+        setPhase(job, LOADING);
+        std::cout<<"Loading backup: Image#"<<img<<", Version#"<<vN<<"\n\n";
+        if (!importVersion(img, imageV)
+            || (spec.imageName!=conf.imageName
+                && !dockerOK(docker.tag(readyTag(img, imageV), spec.imageName, std::to_string(vN)), "tag", readyTag(img, imageV)))) {
+            failRestore(job, img, name);
+            return;
+        }
+    }
+
+    setPhase(job, STARTING);
+    std::cout<<"Starting backup: Image#"<<img<<", Version#"<<vN<<" as "<<name<<"\n\n";
+    if (dockerOK(docker.create(containerSpec(img, image, spec, ports, 0)), "create", name) && populateUpper(img, name)
+        && dockerOK(docker.start(name), "start", name))
+        setPhase(job, READY);
+    else failRestore(job, img, name);
 }
 
-void recoverTheService(int img, int ver){
+//A full image is received under a name of its own and only renamed to img_<imN>_<vN>
+//once complete (finishVersion), so it never overwrites the image file in use, which a
+//rebase resends under the same version.
+std::string transferFile(int imN, int vN, int base) {
+    return base<0?"img_"+std::to_string(imN)+"_"+std::to_string(vN)+".part":"diff_"+std::to_string(imN)+"_"+std::to_string(vN);
+}
 
+//A full image can replace what we have; a diff only applies to exactly its base, and a
+//bsdiff patch only to a base that has an img file of its own, not one made by a change set.
+bool acceptable(int imN, const Version &vs) {
+    if (vs.full()) return vs.version()!=applied[imN];
+    return vs.base()==applied[imN] && vs.version()>vs.base() && (vs.changeset() || imageOf[imN]==applied[imN]);
 }
 
-using grpc::Server;
-using grpc::ServerBuilder;
-using grpc::ServerContext;
-using grpc::Status;
-using namespace recoverer;
+//What replication leaves in the page cache, which it shares with whatever else the host runs:
+//  keep      nothing special
+//  dontneed  written ranges are dropped from the cache once they reach the disk, and files
+//            are dropped as a whole once complete, bspatch input and output included
+//  direct    transfer files are written with O_DIRECT only, whole blocks at a time through
+//            the write-behind buffer, and so are versions pushed whole; where the file
+//            system refuses O_DIRECT the file is written as dontneed instead. bspatch
+//            cannot, so its files are still dropped afterwards
+enum CacheMode {CACHE_KEEP=0, CACHE_DONTNEED, CACHE_DIRECT};
+CacheMode cacheMode=CACHE_KEEP;
 
-class svImpl final:public recover_service::Service{
-    Status TellVersion(ServerContext* context, const Version* request, Reply* response) override;
-    Status Chunk2Send(ServerContext* context, const Image* request, ChunkList* response)  override;
-    Status SendChunk(ServerContext* context, const Chunk* request, Reply* response)  override;
-    Status KeepAlive(ServerContext* context, const Reply* request, Reply* response) override;
-    Status RecoverServ(ServerContext* context, const ImageAndServName* request, Reply* response) override;
+void dropCache(int fd) {
+    sync_file_range(fd, 0, 0, SYNC_FILE_RANGE_WAIT_BEFORE|SYNC_FILE_RANGE_WRITE|SYNC_FILE_RANGE_WAIT_AFTER);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+}
+
+void dropFileCache(const std::string &filename) {
+    if (cacheMode==CACHE_KEEP) return;
+    int fd=open(filename.c_str(), O_RDONLY);
+    if (fd<0) return;
+    dropCache(fd);
+    close(fd);
+}
+
+int removeEntry(const char *path, const struct stat*, int, struct FTW*) {
+    return remove(path);
+}
+
+//Drops the change sets of imN once a full (or patched) image stands on its own.
+void clearUpper(int imN) {
+    std::lock_guard<std::mutex> lk(upperMutex);
+    nftw(upperDir(imN).c_str(), removeEntry, 64, FTW_DEPTH|FTW_PHYS);
+}
+
+//Applies change set diff_<imN>_<vN> to upper_<imN>: extracts its tar, then removes the paths
+//it lists and puts whiteouts there to hide the image's. The image itself stays as it is, in
+//the img file of imageOf. Safe to redo after a restart, which the journal asks for until
+//the version is complete, and so until upper_<imN> has been synced (see syncImage).
+bool applyChanges(int imN, int vN, int base) {
+    std::string diff=transferFile(imN, vN, base);
+    int fd=open(diff.c_str(), O_RDONLY);
+    if (fd<0) return false;
+    struct stat st;
+    char footer[16];
+    uint64_t length=0;
+    bool ok=fstat(fd, &st)==0 && st.st_size>=16 && pread(fd, footer, 16, st.st_size-16)==16
+            && memcmp(footer+8, "UPPERCS1", 8)==0;
+    if (ok) memcpy(&length, footer, 8);
+    ok=ok && length<=(uint64_t)st.st_size-16;
+    std::string removed(ok?length:0, '\0');
+    ok=ok && pread(fd, &removed[0], length, st.st_size-16-length)==(ssize_t)length;
+    close(fd);
+    if (!ok) {
+        std::cout<<diff<<" is not a change set\n";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lk(upperMutex);
+    mkdir(upperDir(imN).c_str(), 0755);
+    //tar stops at the end of the archive, before the list of removed paths
+    if (executeCMD({"tar", "--extract", "--file", diff, "--directory", upperDir(imN), "--numeric-owner",
+                    "--same-permissions", "--xattrs", "--xattrs-include=trusted.*"})!=0)
+        return false;
+    size_t whiteouts=0;
+    for (size_t at=0; at<removed.size(); at=removed.find('\0', at)+1) {
+        std::string path(removed.c_str()+at);
+        if (path.empty() || path[0]=='/' || ("/"+path+"/").find("/../")!=std::string::npos) continue;
+        path=upperDir(imN)+"/"+path;
+        nftw(path.c_str(), removeEntry, 64, FTW_DEPTH|FTW_PHYS);
+        if (mknod(path.c_str(), S_IFCHR|0600, makedev(0, 0))==0) whiteouts++;
+    }
+    size_t wanted=std::count(removed.begin(), removed.end(), '\0');
+    if (whiteouts<wanted) std::cout<<"Could not put "<<wanted-whiteouts<<" whiteouts in "<<upperDir(imN)<<"\n";
+    return true;
+}
+
+int patchTimeoutMs=0;               //bspatch runs longer than this are killed, 0 for no limit
+
+//Turns the received file of version vN into img_<imN>_<vN>, patching diffs onto
+//their base, or applies it to upper_<imN> if it is a change set; returns false if that failed.
+bool finishVersion(int imN, int vN, int base, bool changeset) {
+    if (changeset) {
+        std::cout<<"Applying changes to Image#"<<imN<<", Version#"<<vN<<" onto Version#"<<base<<"\n\n";
+        if (applyChanges(imN, vN, base)) return true;
+        std::cout<<"Failed to apply the changes to Image#"<<imN<<", Version#"<<vN<<"\n\n";
+        return false;
+    }
+    if (base<0) {
+        //Already renamed if this is redone after a restart
+        std::string image="img_"+std::to_string(imN)+"_"+std::to_string(vN);
+        if (rename(transferFile(imN, vN, base).c_str(), image.c_str())!=0
+            && (errno!=ENOENT || access(image.c_str(), F_OK)!=0)) {
+            std::cout<<"Cannot put Image#"<<imN<<", Version#"<<vN<<" in place: "<<strerror(errno)<<"\n\n";
+            return false;
+        }
+        clearUpper(imN);
+        return true;
+    }
+    std::string baseImage="img_"+std::to_string(imN)+"_"+std::to_string(base);
+    std::string image="img_"+std::to_string(imN)+"_"+std::to_string(vN);
+    std::string tmpname=image+".tmp";
+    std::cout<<"Merging incremental data for Image#"<<imN<<", Version#"<<vN<<" onto Version#"<<base<<"\n\n";
+    //Clone the base and write only what the patch changes; bspatch, which writes the whole
+    //image, is the fallback
+    PatchStats stats;
+    auto start=std::chrono::steady_clock::now();
+    if (patchFile(baseImage.c_str(), tmpname.c_str(), transferFile(imN, vN, base).c_str(), stats)
+        && rename(tmpname.c_str(), image.c_str())==0) {
+        std::cout<<"Patched Image#"<<imN<<" to Version#"<<vN<<": wrote "<<stats.written<<" of "<<stats.size
+                 <<" bytes over a "<<stats.clone<<" clone of Version#"<<base<<" in "
+                 <<std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-start).count()<<"ms\n\n";
+    }
+    else {
+        unlink(tmpname.c_str());
+        std::cout<<"Cannot patch Image#"<<imN<<" in place, running bspatch\n";
+        if (executeCMD({"bspatch", baseImage, image, transferFile(imN, vN, base)}, nullptr, patchTimeoutMs)!=0) {
+            std::cout<<"Failed to patch Image#"<<imN<<" to Version#"<<vN<<"\n\n";
+            unlink(image.c_str());
+            return false;
+        }
+        std::cout<<"\n";
+    }
+    dropFileCache("img_"+std::to_string(imN)+"_"+std::to_string(base));
+    dropFileCache(transferFile(imN, vN, base));
+    clearUpper(imN);
+    return true;
+}
+
+//How hard received data is pushed to disk:
+//  none   never synced; survives a recoverer crash, but after a host crash the journal
+//         may count chunks that never reached the disk
+//  group  group commit: one fdatasync, then a journal write, every groupBytes or groupMs.
+//         Writeback of each write is started right away (sync_file_range), so the disk
+//         is kept busy evenly and the fdatasync has little left to wait for
+//  full   fdatasync and a journal write every journalEvery chunks or second
+//Either way a version is synced before it is applied.
+enum Durability {DURABLE_NONE=0, DURABLE_GROUP, DURABLE_FULL};
+Durability durability=DURABLE_FULL;
+int64_t groupBytes=32*1024*1024;
+int groupMs=1000;
+
+//Received data is gathered per image into a write-behind buffer, so runs of contiguous
+//chunks reach the disk as few large writes. The buffer is written when it fills (in whole
+//coalesceAlign blocks; the tail stays buffered), once it is older than coalesceMs (checked
+//by flushLoop too, so the tail of a stalled transfer goes out), when the next chunk is not
+//contiguous, and before every sync, so the journal never counts data that is only in
+//memory. A failed write leaves the buffer as it was, to be retried by the next flush, and
+//a chunk that cannot be taken stays missing. coalesceBytes 0 writes each chunk as it comes.
+int64_t coalesceBytes=0;
+int coalesceMs=200;
+const int64_t coalesceAlign=4096;
+enum FlushReason {FLUSH_SIZE=0, FLUSH_TIME, FLUSH_GAP, FLUSH_SYNC};
+struct WriteBuffer {
+    char *data=nullptr;          //coalesceBytes, aligned to coalesceAlign
+    char *block=nullptr;         //One coalesceAlign block, to read back the edges of direct writes
+    int64_t offset=0, length=0;
+    std::chrono::steady_clock::time_point first;
+    int64_t writes=0, written=0;
+    int64_t flushes[4]={0, 0, 0, 0};
 };
+std::vector<WriteBuffer> writeBuffers;
+std::vector<int> directFd;                              //O_DIRECT descriptor of the transfer file, or -1
+std::vector<std::pair<int64_t, int64_t>> pendingDrop;   //Last buffered write, dropped after the next one
 
-std::vector<int> images;
-std::vector<int> steps;
+//Opens the O_DIRECT descriptor beside fileP[imN] if the cache mode asks for it and the
+//file system allows it. All writes to the file then go through it, fileP only reads and
+//syncs, so the file is never written both ways.
+void openDirect(int imN, const std::string &filename) {
+    directFd[imN]=cacheMode==CACHE_DIRECT?open(filename.c_str(), O_RDWR|O_DIRECT):-1;
+    pendingDrop[imN]={0, 0};
+}
 
-std::vector<std::set<int>> chunkTable;
-std::vector<FILE*> fileP;
+void closeTransferFile(int imN) {
+    fclose(fileP[imN]);
+    fileP[imN]=nullptr;
+    if (directFd[imN]>=0) close(directFd[imN]);
+    directFd[imN]=-1;
+}
+
+//Starts writeback of a range just written and drops the one before it, which has had
+//the time since to reach the disk, from the cache.
+void dropBehind(int imN, int64_t offset, int64_t len) {
+    int fd=fileno(fileP[imN]);
+    sync_file_range(fd, offset, len, SYNC_FILE_RANGE_WRITE);
+    auto &prev=pendingDrop[imN];
+    if (prev.second>0) {
+        sync_file_range(fd, prev.first, prev.second,
+                        SYNC_FILE_RANGE_WAIT_BEFORE|SYNC_FILE_RANGE_WRITE|SYNC_FILE_RANGE_WAIT_AFTER);
+        posix_fadvise(fd, prev.first, prev.second, POSIX_FADV_DONTNEED);
+    }
+    prev={offset, len};
+}
+
+//Writes the pieces in iov back to back at offset, in as few pwritev calls as it takes; with
+//O_DIRECT they must be whole, aligned blocks.
+bool writeOut(int imN, int64_t offset, std::vector<struct iovec> iov) {
+    WriteBuffer &b=writeBuffers[imN];
+    bool direct=directFd[imN]>=0;
+    int fd=direct?directFd[imN]:fileno(fileP[imN]);
+    int64_t start=offset, total=0;
+    for (auto &v:iov) total+=v.iov_len;
+    size_t first=0;
+    while (true) {
+        while (first<iov.size() && iov[first].iov_len==0) first++;
+        if (first==iov.size()) break;
+        ssize_t n=pwritev(fd, iov.data()+first, std::min<size_t>(iov.size()-first, IOV_MAX), offset);
+        if (n<0 && errno==EINTR) continue;
+        if (n<=0) return false;
+        offset+=n;
+        b.written+=n;
+        for (; n>0 && (size_t)n>=iov[first].iov_len; first++) n-=iov[first].iov_len;
+        if (n>0) {
+            iov[first].iov_base=(char*)iov[first].iov_base+n;
+            iov[first].iov_len-=n;
+        }
+    }
+    b.writes++;
+    if (!direct && cacheMode!=CACHE_KEEP) dropBehind(imN, start, total);
+    else if (!direct && durability==DURABLE_GROUP) sync_file_range(fd, start, total, SYNC_FILE_RANGE_WRITE);
+    return true;
+}
+
+//Reads the coalesceAlign block at offset of the transfer file through O_DIRECT into to;
+//what lies past the end of the file reads as zeros.
+bool readBlock(int imN, char *to, int64_t offset) {
+    ssize_t n;
+    while ((n=pread(directFd[imN], to, coalesceAlign, offset))<0 && errno==EINTR);
+    if (n<0) return false;
+    memset(to+n, 0, coalesceAlign-n);
+    return true;
+}
+
+//Writes the first n buffered bytes of imN (all of them for n<0) and keeps the rest.
+bool flushBuffer(int imN, FlushReason reason, int64_t n=-1) {
+    WriteBuffer &b=writeBuffers[imN];
+    if (n<0 || n>b.length) n=b.length;
+    if (n==0) return true;
+    int64_t out=n;
+    //O_DIRECT writes whole blocks: the rest of a last partial one is what the file holds
+    //there. This only happens for the whole buffer, which has room up to the boundary.
+    if (directFd[imN]>=0 && (b.offset+n)%coalesceAlign!=0) {
+        int64_t end=b.offset+n, tail=end/coalesceAlign*coalesceAlign;
+        if (!readBlock(imN, b.block, tail)) return false;
+        out=tail+coalesceAlign-b.offset;
+        memcpy(b.data+n, b.block+(end-tail), out-n);
+    }
+    if (!writeOut(imN, b.offset, {{b.data, (size_t)out}})) return false;
+    b.flushes[reason]++;
+    memmove(b.data, b.data+n, b.length-n);
+    b.offset+=n;
+    b.length-=n;
+    b.first=std::chrono::steady_clock::now();
+    return true;
+}
+
+//Flushes the buffered bytes of imN up to the last coalesceAlign boundary of the file.
+bool flushAligned(int imN, FlushReason reason) {
+    WriteBuffer &b=writeBuffers[imN];
+    int64_t n=(b.offset+b.length)/coalesceAlign*coalesceAlign-b.offset;
+    return n<=0 || flushBuffer(imN, reason, n);
+}
 
-char *zeroBuff;
+bool allocBuffer(WriteBuffer &b) {
+    if (b.data==nullptr && posix_memalign((void**)&b.data, coalesceAlign, coalesceBytes)!=0) b.data=nullptr;
+    if (b.block==nullptr && posix_memalign((void**)&b.block, coalesceAlign, coalesceAlign)!=0) b.block=nullptr;
+    return b.data!=nullptr && b.block!=nullptr;
+}
+
+//With O_DIRECT everything goes through the buffer, which then starts on a block boundary:
+//a write that starts inside a block takes the head of that block from the file first, and
+//chunks longer than the buffer stream through it.
+bool writeDirect(int imN, int64_t offset, const std::vector<struct iovec> &iov) {
+    WriteBuffer &b=writeBuffers[imN];
+    if (b.length==0) {
+        b.offset=offset/coalesceAlign*coalesceAlign;
+        b.length=offset-b.offset;
+        b.first=std::chrono::steady_clock::now();
+        if (b.length>0 && !readBlock(imN, b.data, b.offset)) {
+            b.length=0;
+            return false;
+        }
+    }
+    for (auto &v:iov) {
+        for (size_t done=0; done<v.iov_len; ) {
+            //A chunk cut short here leaves correct data buffered; it stays missing anyway
+            if (b.length==coalesceBytes && !flushAligned(imN, FLUSH_SIZE)) return false;
+            size_t n=std::min<size_t>(v.iov_len-done, coalesceBytes-b.length);
+            memcpy(b.data+b.length, (char*)v.iov_base+done, n);
+            b.length+=n;
+            done+=n;
+        }
+    }
+    if (b.length==coalesceBytes) flushAligned(imN, FLUSH_SIZE);
+    if (b.length>0 && std::chrono::steady_clock::now()-b.first>=std::chrono::milliseconds(coalesceMs))
+        flushBuffer(imN, FLUSH_TIME);
+    return true;
+}
+
+//Writes len bytes, given as the pieces in iov, at offset through the write-behind buffer.
+//Returns false if they could neither be buffered nor written.
+bool writeAt(int imN, int64_t offset, const std::vector<struct iovec> &iov, int64_t len) {
+    WriteBuffer &b=writeBuffers[imN];
+    if (b.length>0 && offset!=b.offset+b.length && !flushBuffer(imN, FLUSH_GAP)) return false;
+    if (directFd[imN]>=0) return allocBuffer(b) && writeDirect(imN, offset, iov);
+    if (b.length+len>coalesceBytes && !flushAligned(imN, FLUSH_SIZE)) return false;
+    if (b.length+len>coalesceBytes && !flushBuffer(imN, FLUSH_SIZE)) return false;
+    if (len>coalesceBytes) return writeOut(imN, offset, iov);
+    if (!allocBuffer(b)) return writeOut(imN, offset, iov);
+    if (b.length==0) {
+        b.offset=offset;
+        b.first=std::chrono::steady_clock::now();
+    }
+    for (auto &v:iov) {
+        memcpy(b.data+b.length, v.iov_base, v.iov_len);
+        b.length+=v.iov_len;
+    }
+    //The data is taken; should these fail, the next flush tries again
+    if (b.length==coalesceBytes) flushAligned(imN, FLUSH_SIZE);
+    if (b.length>0 && std::chrono::steady_clock::now()-b.first>=std::chrono::milliseconds(coalesceMs))
+        flushBuffer(imN, FLUSH_TIME);
+    return true;
+}
+
+//Writes out buffers that grew older than coalesceMs without a chunk coming to do it.
+void flushLoop() {
+    while (1) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::max(coalesceMs/2, 10)));
+        for (int imN=0; imN<maxImages; imN++) {
+            //An image busy with something else flushes on its own
+            std::unique_lock<std::mutex> lk(imageLocks[imN], std::try_to_lock);
+            if (!lk.owns_lock() || steps[imN]!=1 || fileP[imN]==nullptr) continue;
+            WriteBuffer &b=writeBuffers[imN];
+            if (b.length>0 && std::chrono::steady_clock::now()-b.first>=std::chrono::milliseconds(coalesceMs))
+                flushBuffer(imN, FLUSH_TIME);
+        }
+    }
+}
+
+//Per transfer: bytes written since the last sync, and the chunks they belong to, which
+//are only journaled as received once that sync succeeded
+std::vector<int64_t> dirtyBytes;
+std::vector<std::vector<int64_t>> unsynced;
+std::vector<int64_t> receivedBytes;
+std::vector<std::chrono::steady_clock::time_point> transferStart;
+
+void resetTransferStats(int imN) {
+    dirtyBytes[imN]=0;
+    unsynced[imN].clear();
+    receivedBytes[imN]=0;
+    transferStart[imN]=std::chrono::steady_clock::now();
+    WriteBuffer &b=writeBuffers[imN];
+    b.length=0;
+    b.writes=b.written=0;
+    for (auto &f:b.flushes) f=0;
+}
+
+void noteWrite(int imN, int64_t len) {
+    dirtyBytes[imN]+=len;
+    receivedBytes[imN]+=len;
+}
+
+//Syncs the data file of the transfer in progress, written through fd, as the mode asks;
+//returns false if it may not have got to disk. fdatasync also commits the metadata needed
+//to read the data back (allocation of a sparse file, conversion of fallocated extents),
+//which sync_file_range does not, so only it makes chunks safe to journal. final is set
+//when the transfer is complete, and then steps is 2; otherwise this needs no lock, as fd
+//may be a duplicate.
+bool syncData(int imN, int fd, bool final) {
+    bool ok=true;
+    //Direct writes of the last block run past the end of an image file
+    if (final && directFd[imN]>=0 && !logging[imN]) ok=ftruncate(fd, sizes[imN])==0;
+    if (durability!=DURABLE_NONE) ok=fdatasync(fd)==0 && ok;
+    if (final && cacheMode!=CACHE_KEEP) dropCache(fd);
+    return ok;
+}
+
+//Writes out the buffers of the transfer in progress, then syncs it.
+bool flushData(int imN, bool final) {
+    bool ok=flushBuffer(imN, FLUSH_SYNC);
+    ok=fflush(fileP[imN])==0 && ok;
+    dirtyBytes[imN]=0;
+    return syncData(imN, fileno(fileP[imN]), final) && ok;
+}
+
+//Whether the transfer in progress is due for a journal write (and the sync before it).
+const int journalEvery=64;                  //Chunks between journal writes unless grouped
+std::vector<int> unjournaled;
+std::vector<std::chrono::steady_clock::time_point> lastJournal;
+std::vector<bool> journalPending;           //A journal write is on its way; chunks need not ask again
+
+bool journalDue(int imN) {
+    auto elapsed=std::chrono::steady_clock::now()-lastJournal[imN];
+    if (durability==DURABLE_GROUP)
+        return dirtyBytes[imN]>=groupBytes || elapsed>=std::chrono::milliseconds(groupMs);
+    return ++unjournaled[imN]>=journalEvery || elapsed>=std::chrono::seconds(1);
+}
+
+void syncFile(const std::string &filename) {
+    if (durability==DURABLE_NONE) return;
+    int fd=open(filename.c_str(), O_RDONLY);
+    if (fd<0) return;
+    fsync(fd);
+    close(fd);
+}
+
+//Syncs what version vN of imN adds: its img file, or for a change set upper_<imN>, whose
+//entries tar and the whiteouts touched all over, so the file system under it is synced.
+bool syncImage(int imN, int vN, bool changeset) {
+    if (!changeset) {
+        syncFile("img_"+std::to_string(imN)+"_"+std::to_string(vN));
+        return true;
+    }
+    if (durability==DURABLE_NONE) return true;
+    int fd=open(upperDir(imN).c_str(), O_RDONLY|O_DIRECTORY);
+    bool ok=fd>=0 && syncfs(fd)==0;
+    if (!ok) std::cout<<"Cannot sync "<<upperDir(imN)<<": "<<strerror(errno)<<"\n";
+    if (fd>=0) close(fd);
+    return ok;
+}
+
+//With layout log, the chunks of a transfer are appended to chunklog_<image#>_<version>
+//in arrival order as self-describing records, so the disk sees one sequential stream
+//however chunks are reordered or retried. The image file is written in chunk order
+//once the transfer completes, and after a restart the index is rebuilt from the records.
+bool chunkLog=false;
+const uint32_t logMagic=0x4b4e4843;
+struct LogRecord {
+    uint32_t magic;
+    uint32_t length;
+    int64_t number;
+};
+std::vector<std::vector<int64_t>> logIndex;   //Chunk -> offset of its data in the log, -1 if absent
+std::vector<int64_t> logEnd;
+
+std::string logFile(int imN, int vN) {
+    return "chunklog_"+std::to_string(imN)+"_"+std::to_string(vN);
+}
+
+int64_t chunkLength(int imN, int64_t c) {
+    return std::min(chunkSizes[imN], sizes[imN]-c*chunkSizes[imN]);
+}
+
+//Writes chunk cN of the transfer in progress, len bytes given as pieces, where its
+//layout puts it; returns false if it could not.
+bool storeChunk(int imN, int64_t cN, const std::vector<struct iovec> &data, int64_t len) {
+    if (!logging[imN]) {
+        if (!writeAt(imN, cN*chunkSizes[imN], data, len)) return false;
+        noteWrite(imN, len);
+        return true;
+    }
+    LogRecord rec={logMagic, (uint32_t)len, cN};
+    std::vector<struct iovec> record{{&rec, sizeof(rec)}};
+    record.insert(record.end(), data.begin(), data.end());
+    if (!writeAt(imN, logEnd[imN], record, sizeof(rec)+len)) return false;
+    logIndex[imN][cN]=logEnd[imN]+sizeof(rec);
+    noteWrite(imN, sizeof(rec)+len);
+    logEnd[imN]+=sizeof(rec)+len;
+    return true;
+}
+
+//Rebuilds the index of imN's log from its records, keeping the latest copy of each
+//chunk, and cuts off whatever follows the last whole record.
+void scanLog(int imN) {
+    int64_t chunkN=(sizes[imN]+chunkSizes[imN]-1)/chunkSizes[imN];
+    logIndex[imN].assign(chunkN, -1);
+    fseeko(fileP[imN], 0, SEEK_END);
+    int64_t fileEnd=ftello(fileP[imN]), offset=0;
+    LogRecord rec;
+    fseeko(fileP[imN], 0, SEEK_SET);
+    while (fread(&rec, sizeof(rec), 1, fileP[imN])==1 && rec.magic==logMagic && rec.number>=0 && rec.number<chunkN
+           && rec.length==chunkLength(imN, rec.number) && offset+(int64_t)sizeof(rec)+rec.length<=fileEnd) {
+        logIndex[imN][rec.number]=offset+sizeof(rec);
+        offset+=sizeof(rec)+rec.length;
+        fseeko(fileP[imN], offset, SEEK_SET);
+    }
+    if (offset<fileEnd) ftruncate(fileno(fileP[imN]), offset);
+    fseeko(fileP[imN], offset, SEEK_SET);
+    logEnd[imN]=offset;
+}
+
+//Writes the image file of a fully logged transfer in chunk order with copy_file_range
+//(plain reads and writes where the kernel cannot), then drops the log.
+bool compactLog(int imN) {
+    std::string target=transferFile(imN, images[imN], bases[imN]);
+    int in=fileno(fileP[imN]);
+    int out=open(target.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (out<0) return false;
+    if (sizes[imN]>0) posix_fallocate(out, 0, sizes[imN]);
+    std::vector<char> buffer;
+    bool ok=true;
+    for (int64_t c=0; ok && c<(int64_t)logIndex[imN].size(); c++) {
+        loff_t from=logIndex[imN][c], to=c*chunkSizes[imN];
+        int64_t left=chunkLength(imN, c);
+        ok=from>=0;
+        while (ok && left>0) {
+            ssize_t n=copy_file_range(in, &from, out, &to, left, 0);
+            if (n<0 && (errno==ENOSYS || errno==EXDEV || errno==EINVAL || errno==EOPNOTSUPP)) {
+                buffer.resize(chunkSizes[imN]);
+                n=pread(in, buffer.data(), left, from);
+                if (n>0 && pwrite(out, buffer.data(), n, to)!=n) n=-1;
+                if (n>0) {
+                    from+=n;
+                    to+=n;
+                }
+            }
+            ok=n>0;
+            left-=n;
+        }
+    }
+    if (durability!=DURABLE_NONE) ok=fdatasync(out)==0 && ok;
+    if (cacheMode!=CACHE_KEEP) dropCache(out);
+    ok=close(out)==0 && ok;
+    if (!ok) {
+        std::cout<<"Failed to compact the chunk log of Image#"<<imN<<", Version#"<<images[imN]<<"\n\n";
+        unlink(target.c_str());
+        return false;
+    }
+    closeTransferFile(imN);
+    unlink(logFile(imN, images[imN]).c_str());
+    logging[imN]=false;
+    return true;
+}
+
+//Drops the transfer in progress of imN, with what it wrote so far.
+void abandonTransfer(int imN) {
+    writeBuffers[imN].length=0;
+    closeTransferFile(imN);
+    unlink((logging[imN]?logFile(imN, images[imN]):transferFile(imN, images[imN], bases[imN])).c_str());
+    logging[imN]=false;
+    logIndex[imN].clear();
+}
+
+//Takes back chunks whose sync failed: they are missing again, and a complete transfer
+//goes back to receiving.
+void unsync(int imN, const std::vector<int64_t> &chunks) {
+    std::cout<<"Cannot sync Image#"<<imN<<", Version#"<<images[imN]<<", asking for "<<chunks.size()
+             <<" chunks again: "<<strerror(errno)<<"\n";
+    for (int64_t c:chunks) {
+        chunkTable[imN].put(c);
+        if (logging[imN]) logIndex[imN][c]=-1;
+    }
+    if (steps[imN]==2) steps[imN]=1;
+}
+
+//Writes journal_<image#> for imN with the given missing chunks and step.
+bool writeJournal(int imN, const ChunkRanges &missing, int step) {
+    std::string name="journal_"+std::to_string(imN);
+    std::string tmpname=name+".tmp";
+    FILE *j=fopen(tmpname.c_str(), "w");
+    if (j==nullptr) return false;
+    fprintf(j, "%d %d %d %d %lld %lld %zu %d %d\n", applied[imN], images[imN], step, bases[imN],
+            (long long)sizes[imN], (long long)chunkSizes[imN], missing.runs.size(), changesets[imN], imageOf[imN]);
+    for (auto &run:missing.runs) fprintf(j, "%lld %lld\n", (long long)run.first, (long long)run.second);
+    fflush(j);
+    if (durability!=DURABLE_NONE) fsync(fileno(j));
+    bool ok=fclose(j)==0 && rename(tmpname.c_str(), name.c_str())==0;
+    syncFile(".");
+    unjournaled[imN]=0;
+    lastJournal[imN]=std::chrono::steady_clock::now();
+    return ok;
+}
+
+//Each image's replication state is kept in journal_<image#>, replaced atomically.
+//The data file is synced before the journal is written, so after a crash a chunk
+//may be asked for again but is never wrongly taken as received (unless durability
+//is none and the host itself went down). Chunks the sync failed for are missing
+//again, and a complete transfer goes back to receiving; returns false then.
+bool saveJournal(int imN) {
+    bool synced=fileP[imN]==nullptr || flushData(imN, steps[imN]!=1);
+    if (!synced) unsync(imN, unsynced[imN]);
+    unsynced[imN].clear();
+    return writeJournal(imN, chunkTable[imN], steps[imN]) && synced;
+}
+
+//Makes vN the applied version once img_<imN>_<vN>, or for a change set upper_<imN>, is
+//complete and synced (syncImage), then drops the image it replaces.
+void completeVersion(int imN, int vN) {
+    int old=imageOf[imN];
+    int image=changesets[imN]?old:vN;
+    if (!changesets[imN]) dropFileCache("img_"+std::to_string(imN)+"_"+std::to_string(image));
+    if (!changesets[imN] && image==old) {
+        //A rebase, or a controller starting over, resent the img file in use
+        std::lock_guard<std::mutex> lk(preloadMutex);
+        staleReady.insert(imN);
+    }
+    applied[imN]=vN;
+    imageOf[imN]=image;
+    steps[imN]=3;
+    saveJournal(imN);
+
+    //Delete Old Images (change sets keep the one they build on)
+    std::string oldImage="img_"+std::to_string(imN)+"_"+std::to_string(old);
+    if (old>0 && old!=image && access(oldImage.c_str(), F_OK)==0){
+        std::cout<<"Deleting old images\n\n";
+        if (unlink(oldImage.c_str())!=0) std::cout<<"Cannot delete "<<oldImage<<": "<<strerror(errno)<<"\n\n";
+    }
+    schedulePreload(imN);
+}
+
+//Restores the state of imN from its journal after a restart: reopens a transfer in
+//progress so only its missing chunks are needed, and redoes an interrupted patch.
+void loadJournal(int imN) {
+    FILE *j=fopen(("journal_"+std::to_string(imN)).c_str(), "r");
+    if (j==nullptr) return;
+    long long size, chunkSize, first, end;
+    size_t runs;
+    //Journals from before change sets lack the last two fields, and those from before
+    //imageOf the last; their change sets linked the image under their own version
+    char line[256];
+    changesets[imN]=0;
+    int fields=0;
+    if (fgets(line, sizeof(line), j)==nullptr
+        || (fields=sscanf(line, "%d %d %d %d %lld %lld %zu %d %d", &applied[imN], &images[imN], &steps[imN], &bases[imN],
+                          &size, &chunkSize, &runs, &changesets[imN], &imageOf[imN]))<7) {
+        fclose(j);
+        return;
+    }
+    if (fields<9) imageOf[imN]=applied[imN];
+    sizes[imN]=size;
+    chunkSizes[imN]=chunkSize;
+    chunkTable[imN].reset(0);
+    for (size_t i=0; i<runs && fscanf(j, "%lld %lld", &first, &end)==2; i++) {
+        chunkTable[imN].runs[first]=end;
+        chunkTable[imN].count+=end-first;
+    }
+    fclose(j);
+
+    std::cout<<"Image#"<<imN<<": Version#"<<applied[imN]<<" applied";
+    if (steps[imN]!=3) {
+        //A transfer keeps the layout it started with, whatever the config says now
+        std::string filename=logFile(imN, images[imN]);
+        fileP[imN]=fopen(filename.c_str(), "r+b");
+        logging[imN]=fileP[imN]!=nullptr;
+        if (logging[imN]) scanLog(imN);
+        else if (steps[imN]==1) {
+            filename=transferFile(imN, images[imN], bases[imN]);
+            fileP[imN]=fopen(filename.c_str(), "r+b");
+        }
+        if (fileP[imN]!=nullptr) openDirect(imN, filename);
+    }
+    if (steps[imN]==1) {
+        if (fileP[imN]==nullptr) steps[imN]=3;
+        else {
+            //Chunks the journal counts as received but the log lost are asked for again
+            for (int64_t c=0; logging[imN] && c<(int64_t)logIndex[imN].size(); c++)
+                if (logIndex[imN][c]<0 && !chunkTable[imN].missing(c)) chunkTable[imN].put(c);
+            std::cout<<", resuming Version#"<<images[imN]<<" with "<<chunkTable[imN].count<<" chunks missing";
+        }
+    }
+    std::cout<<"\n";
+    if (steps[imN]==2) {
+        bool ok=true;
+        if (logging[imN]) {
+            ok=std::find(logIndex[imN].begin(), logIndex[imN].end(), -1)==logIndex[imN].end() && compactLog(imN);
+            if (!ok) abandonTransfer(imN);
+        }
+        if (ok && finishVersion(imN, images[imN], bases[imN], changesets[imN])
+            && syncImage(imN, images[imN], changesets[imN]))
+            completeVersion(imN, images[imN]);
+        else steps[imN]=3;
+    }
+    else if (applied[imN]>=0) schedulePreload(imN);
+}
 
 Status svImpl::TellVersion(ServerContext *context, const Version *request, Reply *response) {
     int imN=request->image();
     int vN=request->version();
-    if (vN!=images[imN]+1 && steps[imN]!=3) {
+    int base=request->full()?-1:request->base();
+    if (imN<0 || imN>=maxImages || request->chunk_size()<0 || request->chunk_size()>maxChunkSize) {
         response->set_status(9);
         return Status::OK;
     }
-    else {
-        std::string filename;
-        if (vN==0) {
-            filename="img_"+std::to_string(imN)+"_0";
-        }
-        else {
-            filename="diff_"+std::to_string(imN)+"_"+std::to_string(vN);
-        }
-        fileP[imN]=fopen(filename.c_str(), "wb");
-        int chunkN=request->size()/(1024*1024);
-        for (int i=0; i<chunkN; i++) fwrite(zeroBuff, 1, 1024*1024, fileP[imN]);
-        fwrite(zeroBuff, 1, request->size()%(1024*1024), fileP[imN]);
-        chunkN=(request->size()+1024*1024-1)/(1024*1024);
-        images[imN]++;
-        steps[imN]=1;
-        chunkTable[imN].clear();
-        for (int i=0;i<chunkN;i++) chunkTable[imN].insert(i);
+    int64_t chunkSize=request->chunk_size()>0?request->chunk_size():defaultChunkSize;
+    std::lock_guard<std::mutex> lk(imageLocks[imN]);
+    //The same transfer announced again (e.g. the controller restarted): keep what we have
+    if (steps[imN]==1 && images[imN]==vN && bases[imN]==base && changesets[imN]==request->changeset()
+        && sizes[imN]==request->size() && chunkSizes[imN]==chunkSize) {
         response->set_status(8);
         return Status::OK;
     }
+    if (steps[imN]==2 || !acceptable(imN, *request)) {
+        response->set_status(9);
+        return Status::OK;
+    }
+    if (steps[imN]==1) {
+        std::cout<<"Abandoning Image#"<<imN<<", Version#"<<images[imN]<<" for Version#"<<vN<<"\n";
+        abandonTransfer(imN);
+    }
+    int64_t chunkN=(request->size()+chunkSize-1)/chunkSize;
+    std::string filename=chunkLog?logFile(imN, vN):transferFile(imN, vN, base);
+    fileP[imN]=fopen(filename.c_str(), "w+b");
+    if (fileP[imN]==nullptr) {
+        steps[imN]=3;
+        response->set_status(9);
+        return Status::OK;
+    }
+    openDirect(imN, filename);
+    logging[imN]=chunkLog;
+    if (chunkLog) {
+        //Reserve room for every record without growing the file, so appends stay contiguous
+        fallocate(fileno(fileP[imN]), FALLOC_FL_KEEP_SIZE, 0, request->size()+chunkN*(int64_t)sizeof(LogRecord));
+        logIndex[imN].assign(chunkN, -1);
+        logEnd[imN]=0;
+    }
+    //Reserve the whole file up front; fall back to a sparse file where fallocate is unsupported
+    else if (request->size()>0 && posix_fallocate(fileno(fileP[imN]), 0, request->size())!=0)
+        ftruncate(fileno(fileP[imN]), request->size());
+    chunkSizes[imN]=chunkSize;
+    images[imN]=vN;
+    bases[imN]=base;
+    changesets[imN]=request->changeset();
+    sizes[imN]=request->size();
+    steps[imN]=1;
+    transferSerial[imN]++;
+    chunkTable[imN].reset(chunkN);
+    resetTransferStats(imN);
+    saveJournal(imN);
+    response->set_status(8);
+    return Status::OK;
 }
 
-Status svImpl::Chunk2Send(ServerContext *context, const Image *request, ChunkList *response) {
-    response->clear_needed();
-    for (auto i:chunkTable[request->image()]){
-        response->add_needed(i);
+Status svImpl::GetVersion(ServerContext *context, const Image *request, VersionState *response) {
+    int imN=request->image();
+    if (imN<0 || imN>=maxImages) {
+        response->set_applied(-1);
+        response->set_receiving(-1);
+        return Status::OK;
     }
+    std::lock_guard<std::mutex> lk(imageLocks[imN]);
+    response->set_applied(applied[imN]);
+    response->set_receiving(steps[imN]!=3?images[imN]:-1);
+    response->set_missing(steps[imN]==1?chunkTable[imN].count:0);
+    response->set_chunk_size(chunkSizes[imN]);
     return Status::OK;
 }
 
-Status svImpl::SendChunk(ServerContext *context, const Chunk *request, Reply *response) {
-    int imN=request->image();
-    int vN=request->version();
-    int cN=request->number();
-    if (vN!=images[imN]) {
+grpc::ServerUnaryReactor* svImpl::Chunk2Send(grpc::CallbackServerContext *context, const Image *request,
+                                             ChunkList *response) {
+    response->clear_missing();
+    if (request->image()>=0 && request->image()<maxImages) {
+        std::lock_guard<std::mutex> lk(imageLocks[request->image()]);
+        for (auto &run:chunkTable[request->image()].runs){
+            ChunkRange *range=response->add_missing();
+            range->set_first(run.first);
+            range->set_count(run.second-run.first);
+        }
+    }
+    grpc::ServerUnaryReactor *reactor=context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+}
+
+//SendChunk is served raw: the Chunk is decoded straight from the received slices and
+//its payload written from them with pwritev, so it is never gathered into a string.
+//Fields are told apart by the field numbers generated for Chunk.
+struct RawChunk {
+    int image=0, version=0;
+    int64_t number=0, length=0;
+    std::vector<struct iovec> data;     //Pieces of the payload, pointing into the slices
+    bool compressed=false;              //Payload is raw deflate
+    bool hasChecksum=false;
+    uint32_t checksum=0;                //crc32 of the uncompressed payload
+};
+
+struct SliceReader {
+    const std::vector<grpc::Slice> &slices;
+    size_t s=0, pos=0;
+
+    bool atEnd() {
+        while (s<slices.size() && pos==slices[s].size()) {
+            s++;
+            pos=0;
+        }
+        return s==slices.size();
+    }
+
+    bool varint(uint64_t &v) {
+        v=0;
+        for (int shift=0; shift<64; shift+=7) {
+            if (atEnd()) return false;
+            uint8_t b=slices[s].begin()[pos++];
+            v|=(uint64_t)(b&0x7f)<<shift;
+            if (!(b&0x80)) return true;
+        }
+        return false;
+    }
+
+    //Passes over n bytes, adding them to out as pieces unless it is null.
+    bool take(uint64_t n, std::vector<struct iovec> *out) {
+        while (n>0) {
+            if (atEnd()) return false;
+            size_t len=std::min<uint64_t>(n, slices[s].size()-pos);
+            if (out!=nullptr) out->push_back({(void*)(slices[s].begin()+pos), len});
+            pos+=len;
+            n-=len;
+        }
+        return true;
+    }
+};
+
+bool parseChunk(const std::vector<grpc::Slice> &slices, RawChunk &ck) {
+    SliceReader in{slices};
+    uint64_t key, v;
+    while (!in.atEnd()) {
+        if (!in.varint(key)) return false;
+        switch (key&7) {
+            case 0:
+                if (!in.varint(v)) return false;
+                if (key>>3==Chunk::kImageFieldNumber) ck.image=(int32_t)v;
+                else if (key>>3==Chunk::kVersionFieldNumber) ck.version=(int32_t)v;
+                else if (key>>3==Chunk::kNumberFieldNumber) ck.number=(int64_t)v;
+                else if (key>>3==Chunk::kChecksumFieldNumber) {
+                    ck.checksum=(uint32_t)v;
+                    ck.hasChecksum=true;
+                }
+                else if (key>>3==Chunk::kCompressedFieldNumber) ck.compressed=v!=0;
+                break;
+            case 2:
+                if (!in.varint(v)) return false;
+                if (key>>3==Chunk::kDataFieldNumber) {
+                    ck.data.clear();
+                    ck.length=v;
+                    if (!in.take(v, &ck.data)) return false;
+                }
+                else if (!in.take(v, nullptr)) return false;
+                break;
+            case 1:
+                if (!in.take(8, nullptr)) return false;
+                break;
+            case 5:
+                if (!in.take(4, nullptr)) return false;
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+//A compressed chunk is inflated into a buffer of the receiving thread, and a chunk with
+//a checksum is verified against it; a chunk failing either stays missing and is asked
+//for again.
+struct Inflater {
+    z_stream zs{};
+    bool ready;
+    std::vector<char> plain;
+
+    Inflater() {
+        ready=inflateInit2(&zs, -15)==Z_OK;
+    }
+    ~Inflater() {
+        if (ready) inflateEnd(&zs);
+    }
+};
+thread_local Inflater inflater;
+
+bool unpackChunk(RawChunk &ck, int64_t expected) {
+    if (ck.compressed) {
+        z_stream &zs=inflater.zs;
+        if (!inflater.ready) return false;
+        inflateReset(&zs);
+        inflater.plain.resize(expected);
+        zs.next_out=(Bytef*)inflater.plain.data();
+        zs.avail_out=expected;
+        int ret=Z_OK;
+        for (auto &v:ck.data) {
+            if (v.iov_len==0) continue;
+            zs.next_in=(Bytef*)v.iov_base;
+            zs.avail_in=v.iov_len;
+            ret=inflate(&zs, Z_NO_FLUSH);
+            if (ret!=Z_OK) break;
+        }
+        if (ret!=Z_STREAM_END || (int64_t)zs.total_out!=expected) return false;
+        ck.data={{inflater.plain.data(), (size_t)expected}};
+        ck.length=expected;
+    }
+    if (ck.length!=expected) return false;
+    if (ck.hasChecksum) {
+        uLong crc=crc32(0L, Z_NULL, 0);
+        for (auto &v:ck.data) crc=crc32(crc, (const Bytef*)v.iov_base, v.iov_len);
+        if ((uint32_t)crc!=ck.checksum) return false;
+    }
+    return true;
+}
+
+//What a stored chunk leaves to do before it is answered, off the RPC thread.
+enum AfterChunk {AFTER_NONE=0, AFTER_JOURNAL, AFTER_COMPLETE};
+
+//Takes a decoded chunk into the transfer in progress; returns the reply status, and in
+//after what is left to do for the transfer, whose serial it sets.
+int receiveChunk(RawChunk &ck, AfterChunk &after, int64_t &serial) {
+    int imN=ck.image;
+    int vN=ck.version;
+    int64_t cN=ck.number;
+    after=AFTER_NONE;
+    if (imN<0 || imN>=maxImages) return 9;
+    std::lock_guard<std::mutex> lk(imageLocks[imN]);
+    if (vN!=images[imN] || steps[imN]!=1 || ck.length>chunkSizes[imN] || !chunkTable[imN].missing(cN)) return 9;
+    if (!unpackChunk(ck, chunkLength(imN, cN))) {
+        std::cout<<"Rejected chunk#"<<cN<<" of Image#"<<imN<<", Version#"<<vN<<": corrupt\n";
+        return 9;
+    }
+    if (!storeChunk(imN, cN, ck.data, ck.length)) {
+        std::cout<<"Cannot write chunk#"<<cN<<" of Image#"<<imN<<", Version#"<<vN<<": "<<strerror(errno)<<"\n";
+        return 9;
+    }
+    chunkTable[imN].take(cN);
+    unsynced[imN].push_back(cN);
+    serial=transferSerial[imN];
+    if (chunkTable[imN].count==0) {
+        //No other call touches the transfer from here on
+        steps[imN]=2;
+        after=AFTER_COMPLETE;
+    }
+    else if (!journalPending[imN] && journalDue(imN)) {
+        journalPending[imN]=true;
+        after=AFTER_JOURNAL;
+    }
+    return 8;
+}
+
+//Syncs and journals the transfer of imN in progress. The sync runs on a duplicate of its
+//descriptor without the image lock, so chunks keep coming meanwhile; those are journaled
+//as missing, to be counted next time.
+void journalTransfer(int imN, int64_t serial) {
+    std::lock_guard<std::mutex> sl(syncLocks[imN]);
+    std::unique_lock<std::mutex> lk(imageLocks[imN]);
+    if (transferSerial[imN]!=serial || steps[imN]==3 || fileP[imN]==nullptr) {
+        journalPending[imN]=false;
+        return;
+    }
+    std::vector<int64_t> chunks;
+    chunks.swap(unsynced[imN]);
+    bool ok=flushBuffer(imN, FLUSH_SYNC);
+    ok=fflush(fileP[imN])==0 && ok;
+    dirtyBytes[imN]=0;
+    int fd=dup(fileno(fileP[imN]));
+    lk.unlock();
+    ok=fd>=0 && syncData(imN, fd, false) && ok;
+    if (fd>=0) close(fd);
+    lk.lock();
+    journalPending[imN]=false;
+    //A transfer given up meanwhile has nothing left to journal
+    if (transferSerial[imN]!=serial || steps[imN]==3) return;
+    if (!ok) unsync(imN, chunks);
+    ChunkRanges missing=chunkTable[imN];
+    for (int64_t c:unsynced[imN]) missing.put(c);
+    writeJournal(imN, missing, 1);
+}
+
+//Completes the transfer of imN whose last chunk came: the final sync and journal, then
+//compaction and patching. steps 2 keeps every other call off the transfer, so the slow
+//parts run without the image lock.
+void completeTransfer(int imN, int64_t serial) {
+    std::lock_guard<std::mutex> sl(syncLocks[imN]);
+    std::unique_lock<std::mutex> lk(imageLocks[imN]);
+    if (transferSerial[imN]!=serial || steps[imN]!=2) return;
+    int vN=images[imN];
+    std::vector<int64_t> chunks;
+    chunks.swap(unsynced[imN]);
+    bool ok=flushBuffer(imN, FLUSH_SYNC);
+    ok=fflush(fileP[imN])==0 && ok;
+    dirtyBytes[imN]=0;
+    lk.unlock();
+    ok=syncData(imN, fileno(fileP[imN]), true) && ok;
+    lk.lock();
+    if (!ok) {
+        unsync(imN, chunks);
+        writeJournal(imN, chunkTable[imN], steps[imN]);
+        return;
+    }
+    writeJournal(imN, chunkTable[imN], 2);
+    lk.unlock();
+
+    double seconds=std::chrono::duration<double>(std::chrono::steady_clock::now()-transferStart[imN]).count();
+    std::cout<<"Received Image#"<<imN<<", Version#"<<vN<<": "<<receivedBytes[imN]<<" bytes in "<<seconds*1000<<"ms ("
+             <<(seconds>0?receivedBytes[imN]/seconds/1048576:0)<<" MiB/s)\n";
+    WriteBuffer &b=writeBuffers[imN];
+    std::cout<<"  "<<b.writes<<" writes of "<<(b.writes>0?b.written/b.writes/1024:0)<<" KiB on average; flushed by size "
+             <<b.flushes[FLUSH_SIZE]<<", time "<<b.flushes[FLUSH_TIME]<<", gap "<<b.flushes[FLUSH_GAP]<<", sync "
+             <<b.flushes[FLUSH_SYNC]<<"\n";
+    if (logging[imN]) {
+        ok=compactLog(imN);
+        if (!ok) abandonTransfer(imN);
+    }
+    else closeTransferFile(imN);
+    ok=ok && finishVersion(imN, vN, bases[imN], changesets[imN]);
+    ok=ok && syncImage(imN, vN, changesets[imN]);
+    lk.lock();
+    if (ok) completeVersion(imN, vN);
+    else {
+        steps[imN]=3;
+        saveJournal(imN);
+    }
+}
+
+grpc::ServerUnaryReactor* svImpl::SendChunk(grpc::CallbackServerContext *context, const grpc::ByteBuffer *request,
+                                            grpc::ByteBuffer *response) {
+    grpc::ServerUnaryReactor *reactor=context->DefaultReactor();
+    std::vector<grpc::Slice> slices;
+    RawChunk ck;
+    AfterChunk after=AFTER_NONE;
+    int64_t serial=0;
+    int status=9;
+    if (request->Dump(&slices).ok() && parseChunk(slices, ck)) status=receiveChunk(ck, after, serial);
+    int imN=ck.image;
+    auto finish=[=]() {
+        Reply reply;
+        bool own;
+        reply.set_status(status);
+        grpc::SerializationTraits<Reply>::Serialize(reply, response, &own);
+        reactor->Finish(Status::OK);
+    };
+    //Syncing and patching would hold up a thread the server needs for other calls; the
+    //chunk is answered once they are done, so the sender is held back instead
+    if (after==AFTER_NONE) finish();
+    else std::thread([=]() {
+        if (after==AFTER_JOURNAL) journalTransfer(imN, serial);
+        else completeTransfer(imN, serial);
+        finish();
+    }).detach();
+    return reactor;
+}
+
+//Writes a version sent whole to filename the way cacheMode asks: with O_DIRECT through an
+//aligned copy whose last block is padded and cut off again, or buffered and then dropped.
+bool writeWhole(const std::string &filename, const std::string &data) {
+    int fd=cacheMode==CACHE_DIRECT?open(filename.c_str(), O_WRONLY|O_CREAT|O_TRUNC|O_DIRECT, 0644):-1;
+    bool direct=fd>=0;
+    if (!direct) fd=open(filename.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (fd<0) return false;
+    int64_t size=data.size(), length=direct?(size+coalesceAlign-1)/coalesceAlign*coalesceAlign:size;
+    char *copy=nullptr;
+    bool ok=!direct || posix_memalign((void**)&copy, coalesceAlign, std::max(length, coalesceAlign))==0;
+    const char *from=data.data();
+    if (direct && ok) {
+        memcpy(copy, data.data(), size);
+        memset(copy+size, 0, length-size);
+        from=copy;
+    }
+    for (int64_t done=0; ok && done<length; ) {
+        ssize_t n=pwrite(fd, from+done, length-done, done);
+        if (n<0 && errno==EINTR) continue;
+        ok=n>0;
+        done+=n;
+    }
+    free(copy);
+    if (direct) ok=ok && ftruncate(fd, size)==0;
+    else if (cacheMode!=CACHE_KEEP) dropCache(fd);
+    ok=close(fd)==0 && ok;
+    return ok;
+}
+
+//Applies a version sent whole in one message.
+Status pushVersion(const InlineVersion *request, Reply *response) {
+    const Version &vs=request->version();
+    int imN=vs.image();
+    int vN=vs.version();
+    int base=vs.full()?-1:vs.base();
+    if (imN<0 || imN>=maxImages) {
         response->set_status(9);
         return Status::OK;
     }
-    if (chunkTable[imN].find(cN)==chunkTable[imN].end()) {
+    std::unique_lock<std::mutex> lk(imageLocks[imN]);
+    if (steps[imN]==2 || !acceptable(imN, vs) || (int64_t)request->data().size()!=vs.size()) {
         response->set_status(9);
         return Status::OK;
     }
-    chunkTable[imN].erase(cN);
-    fseek(fileP[imN], 1024*1024*cN, SEEK_SET);
-    fwrite(request->data().c_str(), 1, request->data().size(), fileP[imN]);
-    if (chunkTable[imN].size()==0) {
-        fclose(fileP[imN]);
-        steps[imN]=2;
-        if (images[imN]!=0) {
-            //Patch
-            char commandStr[1024];
-            sprintf(commandStr, "bspatch img_%d_%d img_%d_%d diff_%d_%d", imN, vN-1, imN, vN, imN, vN);
-            std::cout<<"Merging incremental data for Image#"<<imN<<", Version#"<<vN<<"\n\n";
-            executeCMD(commandStr);
-            std::cout<<"\n";
-
-            //Delete Old Images
-            if (vN!=1){
-                sprintf(commandStr, "rm img_%d_%d", imN, vN-1);
-                std::cout<<"Deleting old images\n\n";
-                executeCMD(commandStr);
-                std::cout<<"\n";
-            }
-
-        }
+    if (steps[imN]==1) {
+        std::cout<<"Abandoning Image#"<<imN<<", Version#"<<images[imN]<<" for Version#"<<vN<<"\n";
+        abandonTransfer(imN);
+        steps[imN]=3;
+        chunkTable[imN].reset(0);
+        saveJournal(imN);
+    }
+    //Like a transfer being patched, steps 2 keeps other calls away while the lock is off
+    images[imN]=vN;
+    bases[imN]=base;
+    changesets[imN]=vs.changeset();
+    sizes[imN]=vs.size();
+    chunkTable[imN].reset(0);
+    steps[imN]=2;
+    transferSerial[imN]++;
+    lk.unlock();
+    std::string filename=transferFile(imN, vN, base);
+    std::string tmpname=filename+".tmp";
+    bool ok=writeWhole(tmpname, request->data());
+    ok=ok && rename(tmpname.c_str(), filename.c_str())==0;
+    //The version only becomes visible once the file is in place and patched
+    ok=ok && finishVersion(imN, vN, base, vs.changeset());
+    ok=ok && syncImage(imN, vN, vs.changeset());
+    lk.lock();
+    if (!ok) {
+        unlink(tmpname.c_str());
         steps[imN]=3;
+        response->set_status(9);
+        return Status::OK;
     }
+    completeVersion(imN, vN);
+    response->set_status(8);
     return Status::OK;
 }
 
+grpc::ServerUnaryReactor* svImpl::PushVersion(grpc::CallbackServerContext *context, const InlineVersion *request,
+                                              Reply *response) {
+    grpc::ServerUnaryReactor *reactor=context->DefaultReactor();
+    //Writing and patching take a thread of their own, as for the last chunk of a transfer
+    std::thread([=]() { reactor->Finish(pushVersion(request, response)); }).detach();
+    return reactor;
+}
+
 Status svImpl::KeepAlive(ServerContext *context, const Reply *request, Reply *response) {
     response->set_status(8);
     return Status::OK;
 }
 
-Status svImpl::RecoverServ(ServerContext *context, const ImageAndServName *request, Reply *response) {
+Status svImpl::RecoverServ(ServerContext *context, const ImageAndServName *request, RecoverJob *response) {
     int img=request->image();
-    int version=(steps[img]==3?images[img]:images[img]-1);
-    if (version>=0) {
-        std::cout<<"To recover "<<img<<" "<<version<<std::endl;
-    }
-    int vN=images[img];
-    if (steps[img]!=3) vN--;
-    if (vN==-1) return Status::OK;
-
-    char commandStr[1024];
-    sprintf(commandStr, "docker load --input img_%d_%d", img, vN);
-    std::cout<<"Loading backup: Image#"<<img<<", Version#"<<vN<<"\n\n";
-    executeCMD(commandStr);
-
-    char servname[32]="kvrunning";
-    sprintf(commandStr, "docker run --name serv_recv -p 4000:8000 %s:%d manage.py runserver 0.0.0.0:8000", servname, vN);
-    std::cout<<"Loading backup: Image#"<<img<<", Version#"<<vN<<"\n\n";
-    executeCMD(commandStr);
-    std::cout<<"\n";
+    if (img<0 || img>=maxImages) {
+        response->set_status(9);
+        return Status::OK;
+    }
+    ServSpec spec=specOf(img);
+    if (!request->servname().empty()) spec.name=request->servname();
+    if (!request->spec().image().empty()) spec.imageName=request->spec().image();
+    if (request->spec().ports_size()>0) spec.ports.assign(request->spec().ports().begin(), request->spec().ports().end());
+    if (!request->spec().command().empty()) spec.command=request->spec().command();
+
+    int vN, imageV;
+    {
+        std::lock_guard<std::mutex> lk(imageLocks[img]);
+        vN=applied[img];
+        imageV=imageOf[img];
+    }
+
+    std::lock_guard<std::mutex> lk(jobMutex);
+    auto it=activeJob.find(img);
+    if (it!=activeJob.end()) {
+        const JobInfo &last=jobs[it->second];
+        //A retry of the same failure, or any call while a restore is under way, gets that job.
+        //A service that was restored, came back and failed again is restarted by a new job.
+        bool running=last.phase!=READY && last.phase!=FAILED;
+        if (running || (last.failure==request->failure() && last.phase==READY)) {
+            response->set_status(8);
+            response->set_job(it->second);
+            return Status::OK;
+        }
+    }
+
+    if (vN==-1) {
+        response->set_status(9);
+        return Status::OK;
+    }
+    std::cout<<"To recover "<<img<<" "<<vN<<std::endl;
+
+    //The job it replaces is finished and no longer asked about
+    if (it!=activeJob.end()) jobs.erase(it->second);
+    int job=nextJob++;
+    JobInfo &info=jobs[job];
+    info.image=img;
+    info.version=vN;
+    info.failure=request->failure();
+    info.phase=QUEUED;
+    info.start=std::chrono::steady_clock::now();
+    activeJob[img]=job;
+    std::thread(recoverTheService, job, img, vN, imageV, spec).detach();
 
+    response->set_status(8);
+    response->set_job(job);
+    return Status::OK;
+}
+
+Status svImpl::RecoverStatus(ServerContext *context, const RecoverJob *request, RecoverJobStatus *response) {
+    std::lock_guard<std::mutex> lk(jobMutex);
+    auto it=jobs.find(request->job());
+    if (it==jobs.end()) {
+        response->set_status(9);
+        return Status::OK;
+    }
+    const JobInfo &info=it->second;
+    auto until=(info.phase==READY || info.phase==FAILED)?info.end:std::chrono::steady_clock::now();
+    response->set_status(8);
+    response->set_phase(info.phase);
+    response->set_image(info.image);
+    response->set_version(info.version);
+    response->set_elapsed_ms(std::chrono::duration_cast<std::chrono::milliseconds>(until-info.start).count());
+    response->set_container(info.container);
+    for (auto &m:info.ports) {
+        PortMapping *pm=response->add_ports();
+        pm->set_container_port(m.first);
+        pm->set_host_port(m.second);
+    }
     return Status::OK;
 }
 
 int main(int argc, char** argv){
-    if (argc!=2) {
-        std::cout<<"recoverer [port]\n";
+    if (argc!=2 && argc!=3) {
+        std::cout<<"recoverer [port] [config file]\n";
         return 0;
     }
 
-    images.resize(3);
-    images[1]=images[2]=-1;
-    steps.resize(3);
-    steps[1]=steps[2]=3;
-    fileP.resize(3);
-    chunkTable.resize(3);
-    zeroBuff=new char[1024*1024];
-    memchr(zeroBuff, 0, 1024*1024);
+    //Config lines:
+    //  budget <MB>                             memory shared by paused standbys
+    //  standby <image#> created|paused <MB>    keep a warm container for the image
+    //  ports <low> <high>                      host ports handed out to restored services
+    //  durability none|full|group <MB> <ms>    how received data is synced to disk
+    //  layout direct|log                       write chunks in place, or append them to a log
+    //  coalesce <KiB> <ms>                     gather contiguous chunks into writes of up to KiB
+    //  cache keep|dontneed|direct              keep received data out of the page cache
+    //  patchtimeout <s>                        kill bspatch after this long, 0 for no limit
+    //  service <image#> <name> <image name> <port,port,...> <command...>
+    //  docker <socket path>                    the Docker Engine API socket (default DOCKER_HOST
+    //                                          if it is unix://, else /var/run/docker.sock)
+    if (argc==3) {
+        FILE* config=fopen(argv[2], "r");
+        if (config==nullptr) {
+            std::cout<<"Cannot open "<<argv[2]<<"\n";
+            return 0;
+        }
+        char key[64], mode[64];
+        while (fscanf(config, "%63s", key)==1) {
+            if (strcmp(key, "budget")==0) fscanf(config, "%d", &memBudgetMB);
+            else if (strcmp(key, "standby")==0) {
+                int img;
+                StandbyConf conf;
+                fscanf(config, "%d %63s %d", &img, mode, &conf.memMB);
+                conf.mode=strcmp(mode, "paused")==0?WARM_PAUSED:(strcmp(mode, "created")==0?WARM_CREATED:WARM_NONE);
+                standbyConf[img]=conf;
+            }
+            else if (strcmp(key, "ports")==0) fscanf(config, "%d %d", &portLow, &portHigh);
+            else if (strcmp(key, "durability")==0) {
+                fscanf(config, "%63s", mode);
+                if (strcmp(mode, "none")==0) durability=DURABLE_NONE;
+                else if (strcmp(mode, "group")==0) {
+                    long long mb;
+                    durability=DURABLE_GROUP;
+                    fscanf(config, "%lld %d", &mb, &groupMs);
+                    groupBytes=mb*1024*1024;
+                }
+                else durability=DURABLE_FULL;
+            }
+            else if (strcmp(key, "layout")==0) {
+                fscanf(config, "%63s", mode);
+                chunkLog=strcmp(mode, "log")==0;
+            }
+            else if (strcmp(key, "coalesce")==0) {
+                long long kb;
+                fscanf(config, "%lld %d", &kb, &coalesceMs);
+                coalesceBytes=std::max(kb*1024/coalesceAlign*coalesceAlign, 0LL);
+            }
+            else if (strcmp(key, "cache")==0) {
+                fscanf(config, "%63s", mode);
+                cacheMode=strcmp(mode, "direct")==0?CACHE_DIRECT:(strcmp(mode, "dontneed")==0?CACHE_DONTNEED:CACHE_KEEP);
+            }
+            else if (strcmp(key, "patchtimeout")==0) {
+                fscanf(config, "%d", &patchTimeoutMs);
+                patchTimeoutMs*=1000;
+            }
+            else if (strcmp(key, "docker")==0) {
+                char path[256];
+                fscanf(config, "%255s", path);
+                docker.socketPath=path;
+            }
+            else if (strcmp(key, "service")==0) {
+                int img;
+                char name[256], imageName[256], ports[256], command[1024];
+                fscanf(config, "%d %255s %255s %255s %1023[^\n]", &img, name, imageName, ports, command);
+                ServSpec &spec=servSpecs[img];
+                spec.name=name;
+                spec.imageName=imageName;
+                spec.command=command;
+                for (char *p=strtok(ports, ","); p!=nullptr; p=strtok(nullptr, ",")) spec.ports.push_back(atoi(p));
+            }
+            else std::cout<<"Unknown config key "<<key<<"\n";
+        }
+        fclose(config);
+        //O_DIRECT needs aligned buffers, which only the write-behind buffer provides
+        if (cacheMode==CACHE_DIRECT && coalesceBytes==0) coalesceBytes=4*1024*1024;
+        if (cacheMode==CACHE_DIRECT) coalesceBytes=(coalesceBytes+coalesceAlign-1)/coalesceAlign*coalesceAlign;
+    }
+
+    images.assign(maxImages, -1);
+    steps.assign(maxImages, 3);
+    applied.assign(maxImages, -1);
+    imageOf.assign(maxImages, -1);
+    bases.assign(maxImages, -1);
+    changesets.assign(maxImages, 0);
+    sizes.assign(maxImages, 0);
+    fileP.assign(maxImages, nullptr);
+    unjournaled.assign(maxImages, 0);
+    lastJournal.resize(maxImages);
+    journalPending.assign(maxImages, false);
+    transferSerial.assign(maxImages, 0);
+    logging.assign(maxImages, false);
+    logIndex.resize(maxImages);
+    logEnd.assign(maxImages, 0);
+    writeBuffers.resize(maxImages);
+    directFd.assign(maxImages, -1);
+    pendingDrop.assign(maxImages, {0, 0});
+    dirtyBytes.resize(maxImages);
+    unsynced.resize(maxImages);
+    receivedBytes.resize(maxImages);
+    transferStart.resize(maxImages);
+    for (int i=0; i<maxImages; i++) resetTransferStats(i);
+    chunkTable.resize(maxImages);
+    chunkSizes.assign(maxImages, defaultChunkSize);
+
+    for (int i=0; i<maxImages; i++) loadJournal(i);
+    if (coalesceBytes>0) std::thread(flushLoop).detach();
 
     svImpl service;
     ServerBuilder builder;
     builder.AddListeningPort(std::string("0.0.0.0:")+argv[1], grpc::InsecureServerCredentials());
+    builder.SetMaxReceiveMessageSize(maxChunkSize+64*1024);
     builder.RegisterService(&service);
     std::unique_ptr<Server> server(builder.BuildAndStart());
     server->Wait();
-    delete[] zeroBuff;
     return 0;
 }
\ No newline at end of file
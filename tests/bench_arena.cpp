@@ -0,0 +1,133 @@
+//
+// Heap traffic of the messages arenas are meant to keep off the heap: counts operator new
+// calls (protobuf allocates through it, arena blocks included) per call cycle, for the
+// recoverer's callback methods with the default per-call messages and with ArenaAllocator,
+// and for the controller's replies parsed onto an arena on a fixed block.
+//
+// bench_arena [cycles, default 100000]
+//
+
+#include "arena_allocator.h"
+#include "recover_service.pb.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+using namespace recoverer;
+
+std::atomic<int64_t> allocations{0};
+
+void* operator new(size_t n) {
+    allocations++;
+    void *p=malloc(n>0?n:1);
+    if (p==nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+//Runs cycle n times after warming up; prints the allocations and the time per cycle.
+template <class F>
+void measure(const char *name, int64_t n, F cycle) {
+    for (int i=0; i<100; i++) cycle();
+    int64_t before=allocations;
+    auto start=std::chrono::steady_clock::now();
+    for (int64_t i=0; i<n; i++) cycle();
+    double ns=std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now()-start).count();
+    printf("%-44s %8.2f allocations %10.0f ns per cycle\n", name, (double)(allocations-before)/n, ns/n);
+}
+
+//A missing list as a recoverer answers it: runs, every other chunk missing
+void fillList(ChunkList *list) {
+    for (int i=0; i<64; i++) {
+        ChunkRange *range=list->add_missing();
+        range->set_first(2*i);
+        range->set_count(1);
+    }
+}
+
+int main(int argc, char **argv) {
+    int64_t n=argc>1?atoll(argv[1]):100000;
+    std::string image, list, push, out;
+    {
+        Image img;
+        img.set_image(3);
+        img.SerializeToString(&image);
+        ChunkList ckl;
+        fillList(&ckl);
+        ckl.SerializeToString(&list);
+        InlineVersion iv;
+        iv.mutable_version()->set_image(3);
+        iv.mutable_version()->set_version(7);
+        iv.mutable_version()->set_size(48*1024);
+        iv.set_data(std::string(48*1024, 'x'));
+        iv.SerializeToString(&push);
+    }
+    out.reserve(64*1024);
+
+    //Server side: grpc's default holder news the request and the response for every call
+    measure("Chunk2Send, messages per call", n, [&]() {
+        Image *req=new Image;
+        ChunkList *resp=new ChunkList;
+        req->ParseFromString(image);
+        fillList(resp);
+        resp->SerializeToString(&out);
+        delete req;
+        delete resp;
+    });
+    ArenaAllocator<Image, ChunkList> listAllocator(16*1024);
+    measure("Chunk2Send, ArenaAllocator", n, [&]() {
+        grpc::MessageHolder<Image, ChunkList> *h=listAllocator.AllocateMessages();
+        h->request()->ParseFromString(image);
+        fillList(h->response());
+        h->response()->SerializeToString(&out);
+        h->Release();
+    });
+    measure("PushVersion 48 KiB, messages per call", n/10, [&]() {
+        InlineVersion *req=new InlineVersion;
+        Reply *resp=new Reply;
+        req->ParseFromString(push);
+        resp->set_status(8);
+        resp->SerializeToString(&out);
+        delete req;
+        delete resp;
+    });
+    ArenaAllocator<InlineVersion, Reply> pushAllocator(64*1024);
+    //The bytes of data still go to the heap: protobuf keeps string fields there
+    measure("PushVersion 48 KiB, ArenaAllocator", n/10, [&]() {
+        grpc::MessageHolder<InlineVersion, Reply> *h=pushAllocator.AllocateMessages();
+        h->request()->ParseFromString(push);
+        h->response()->set_status(8);
+        h->response()->SerializeToString(&out);
+        h->Release();
+    });
+
+    //Client side: the controller's Chunk2Send round, request built and reply parsed
+    measure("Chunk2Send reply, heap messages", n, [&]() {
+        Image img;
+        ChunkList ckl;
+        img.set_image(3);
+        img.SerializeToString(&out);
+        ckl.ParseFromString(list);
+    });
+    static char block[16*1024];
+    measure("Chunk2Send reply, arena on a fixed block", n, [&]() {
+        google::protobuf::Arena arena(block, sizeof(block));
+        Image *img=google::protobuf::Arena::CreateMessage<Image>(&arena);
+        ChunkList *ckl=google::protobuf::Arena::CreateMessage<ChunkList>(&arena);
+        img->set_image(3);
+        img->SerializeToString(&out);
+        ckl->ParseFromString(list);
+    });
+    return 0;
+}
@@ -0,0 +1,95 @@
+//
+// What each durability mode costs a transfer: sends the same full image to a fresh
+// recoverer per mode and reports throughput until the version is applied, and the
+// per-chunk reply latency a co-located service would see stalls in.
+//
+// bench_durability [recoverer binary] [MiB, default 1024] [runs per mode, default 3]
+//
+
+#include "harness.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace recoverer;
+
+const int64_t chunkSize=1024*1024;
+RecovererRun run;
+
+struct Result {
+    double seconds;
+    double p50Ms, p99Ms, maxMs;
+};
+
+Result transfer(int64_t size, const std::vector<char> &data) {
+    Version vs;
+    vs.set_image(1);
+    vs.set_version(0);
+    vs.set_size(size);
+    vs.set_chunk_size(chunkSize);
+    vs.set_full(true);
+    vs.set_base(-1);
+    Reply rpl;
+    auto start=std::chrono::steady_clock::now();
+    {
+        grpc::ClientContext cc;
+        CHECK(run.stub->TellVersion(&cc, vs, &rpl).ok() && rpl.status()==8);
+    }
+    std::vector<double> latency;
+    Chunk ck;
+    ck.set_image(1);
+    ck.set_version(0);
+    for (int64_t c=0; c*chunkSize<size; c++) {
+        int64_t len=std::min(chunkSize, size-c*chunkSize);
+        ck.set_number(c);
+        ck.set_data(data.data()+(c%16)*chunkSize, len);
+        grpc::ClientContext cc;
+        auto sent=std::chrono::steady_clock::now();
+        CHECK(run.stub->SendChunk(&cc, ck, &rpl).ok() && rpl.status()==8);
+        latency.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now()-sent).count());
+    }
+    CHECK(waitApplied(run.stub.get(), 1, 0, 600*1000));
+    Result r;
+    r.seconds=std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+    std::sort(latency.begin(), latency.end());
+    r.p50Ms=latency[latency.size()/2];
+    r.p99Ms=latency[latency.size()*99/100];
+    r.maxMs=latency.back();
+    return r;
+}
+
+int main(int argc, char **argv) {
+    if (argc<2 || argc>4) {
+        std::cout<<"bench_durability [recoverer binary] [MiB] [runs per mode]\n";
+        return 1;
+    }
+    int64_t size=(argc>2?atoll(argv[2]):1024)*1024*1024;
+    int runs=argc>3?atoi(argv[3]):3;
+    //16 MiB of noise, reused round robin
+    std::vector<char> data(16*chunkSize);
+    std::mt19937_64 rng(1);
+    for (size_t i=0; i<data.size(); i+=8) {
+        uint64_t v=rng();
+        memcpy(&data[i], &v, 8);
+    }
+    const char *modes[]={"none", "group 32 1000", "group 8 100", "full"};
+    double baseline=0;
+    std::cout<<"mode              MiB/s   vs none   chunk p50 ms   p99 ms   max ms   (best of "<<runs<<", "
+             <<size/1048576<<" MiB)\n";
+    for (const char *mode:modes) {
+        Result best={1e9, 0, 0, 0};
+        for (int i=0; i<runs; i++) {
+            //Start each run with no dirty pages left by the one before
+            sync();
+            run.start(argv[1], std::string("docker /nonexistent/docker.sock\ndurability ")+mode+"\n");
+            Result r=transfer(size, data);
+            run.stop();
+            if (r.seconds<best.seconds) best=r;
+        }
+        double mibs=size/1048576/best.seconds;
+        if (baseline==0) baseline=mibs;
+        printf("%-16s %7.1f   %6.1f%%   %12.2f %8.2f %8.2f\n", mode, mibs, 100*(mibs/baseline-1), best.p50Ms,
+               best.p99Ms, best.maxMs);
+    }
+    return 0;
+}
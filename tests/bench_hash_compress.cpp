@@ -0,0 +1,117 @@
+//
+// What fusing the checksum and compression passes buys the controller's readers: runs
+// hashCompress, which takes each 32 KiB block through crc32 and then deflate while it is
+// in cache, against separate passes over the whole chunk, crc32 then deflate, and reports
+// bytes per cycle (TSC reference cycles where there is a TSC) and MiB/s.
+//
+// bench_hash_compress [MiB of data, default 256] [deflate level, default 1]
+//
+
+#include "chunk_codec.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+uint64_t cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+//The separate-pass version hashCompress replaced: crc32 over the whole chunk, then deflate
+//over it again.
+int64_t hashThenCompress(z_stream &zs, const char *data, int64_t len, bool hash, bool compress,
+                         std::vector<char> &out, uint32_t &checksum) {
+    checksum=crc32(0L, Z_NULL, 0);
+    if (hash) checksum=crc32(checksum, (const Bytef*)data, len);
+    if (!compress) return -1;
+    out.resize(deflateBound(&zs, len));
+    deflateReset(&zs);
+    zs.next_out=(Bytef*)out.data();
+    zs.avail_out=out.size();
+    zs.next_in=(Bytef*)data;
+    zs.avail_in=len;
+    if (deflate(&zs, Z_FINISH)==Z_STREAM_ERROR || (int64_t)zs.total_out>=len) return -1;
+    return zs.total_out;
+}
+
+//Image-like content: runs of text, zeros and random bytes
+std::vector<char> makeData(int64_t size) {
+    std::vector<char> data(size);
+    std::mt19937_64 rng(1);
+    for (int64_t at=0; at<size; ) {
+        int64_t n=std::min<int64_t>(size-at, 4096+rng()%61440);
+        int kind=rng()%4;
+        for (int64_t i=0; i<n; i++) {
+            if (kind==0) data[at+i]=(char)rng();
+            else if (kind==1) data[at+i]=0;
+            else data[at+i]="usr/lib/x86_64-linux-gnu/libfile.so.6 0644 root\n"[(at+i)%48];
+        }
+        at+=n;
+    }
+    return data;
+}
+
+typedef int64_t (*Codec)(z_stream&, const char*, int64_t, bool, bool, std::vector<char>&, uint32_t&);
+
+struct Result {
+    double bytesPerCycle, mibPerSecond;
+    int64_t packed;
+    uint32_t checksum;
+};
+
+//Runs codec over data in chunks of chunkSize, the best of three rounds.
+Result run(Codec codec, const std::vector<char> &data, int64_t chunkSize, int level) {
+    z_stream zs{};
+    deflateInit2(&zs, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+    std::vector<char> out;
+    Result best{0, 0, 0, 0};
+    for (int round=0; round<3; round++) {
+        Result r{0, 0, 0, 0};
+        auto start=std::chrono::steady_clock::now();
+        uint64_t c0=cycles();
+        for (int64_t off=0; off<(int64_t)data.size(); off+=chunkSize) {
+            int64_t len=std::min<int64_t>(chunkSize, data.size()-off);
+            uint32_t crc;
+            int64_t n=codec(zs, data.data()+off, len, true, true, out, crc);
+            r.packed+=n>=0?n:len;
+            r.checksum^=crc;
+        }
+        uint64_t c1=cycles();
+        double seconds=std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+        r.bytesPerCycle=c1>c0?(double)data.size()/(c1-c0):0;
+        r.mibPerSecond=data.size()/seconds/1048576;
+        if (r.mibPerSecond>best.mibPerSecond) best=r;
+    }
+    deflateEnd(&zs);
+    return best;
+}
+
+int main(int argc, char **argv) {
+    int64_t size=(argc>1?atoll(argv[1]):256)*1024*1024;
+    int level=argc>2?atoi(argv[2]):1;
+    std::vector<char> data=makeData(size);
+    printf("%lld MiB, deflate level %d\n", (long long)(size>>20), level);
+    printf("%-10s %18s %14s %21s %17s %8s\n", "chunk", "fused bytes/cycle", "fused MiB/s", "separate bytes/cycle",
+           "separate MiB/s", "speedup");
+    for (int64_t chunkSize : {256*1024LL, 1024*1024LL, 4*1024*1024LL, 16*1024*1024LL}) {
+        Result fused=run(hashCompress, data, chunkSize, level);
+        Result separate=run(hashThenCompress, data, chunkSize, level);
+        if (fused.checksum!=separate.checksum) {
+            printf("Checksums differ for %lld byte chunks\n", (long long)chunkSize);
+            return 1;
+        }
+        printf("%-10s %18.3f %14.1f %21.3f %17.1f %7.2fx\n",
+               (std::to_string(chunkSize/1024)+" KiB").c_str(), fused.bytesPerCycle, fused.mibPerSecond,
+               separate.bytesPerCycle, separate.mibPerSecond, fused.mibPerSecond/separate.mibPerSecond);
+    }
+    return 0;
+}
@@ -0,0 +1,324 @@
+//
+// Runs DockerClient against a fake daemon on a Unix socket of its own: checks the requests
+// it sends for the operations the controller and the recoverer use, that save and load
+// bodies stream through (sized, chunked and cut short), and that failures come back with
+// the daemon's message.
+//
+// docker_client_test
+//
+
+#include "docker_client.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            std::cerr<<__FILE__<<":"<<__LINE__<<": check failed: "<<#cond<<"\n";   \
+            exit(1);                                                                \
+        }                                                                           \
+    } while (0)
+
+//What the fake daemon was asked
+struct Request {
+    std::string method, path, contentType, body;
+};
+
+//Answers each connection with what handler returns for its request, then closes it, as
+//the client asks (Connection: close).
+class FakeDaemon {
+public:
+    std::function<std::string(const Request&)> handler;
+    std::string socketPath;
+
+    FakeDaemon() {
+        char dir[]="/tmp/docker_client_test.XXXXXX";
+        CHECK(mkdtemp(dir)!=nullptr);
+        socketPath=std::string(dir)+"/d.sock";
+        struct sockaddr_un addr{};
+        addr.sun_family=AF_UNIX;
+        strcpy(addr.sun_path, socketPath.c_str());
+        listener=socket(AF_UNIX, SOCK_STREAM|SOCK_CLOEXEC, 0);
+        CHECK(listener>=0 && bind(listener, (struct sockaddr*)&addr, sizeof(addr))==0 && listen(listener, 4)==0);
+        server=std::thread([this]() { serve(); });
+    }
+
+    ~FakeDaemon() {
+        shutdown(listener, SHUT_RDWR);
+        server.join();
+        close(listener);
+        unlink(socketPath.c_str());
+        rmdir(socketPath.substr(0, socketPath.rfind('/')).c_str());
+    }
+
+    Request last() {
+        std::lock_guard<std::mutex> lk(mutex);
+        return lastRequest;
+    }
+
+private:
+    int listener=-1;
+    std::thread server;
+    std::mutex mutex;
+    Request lastRequest;
+
+    void serve() {
+        while (true) {
+            int conn=accept(listener, nullptr, nullptr);
+            if (conn<0) return;
+            Request req;
+            if (readRequest(conn, req)) {
+                {
+                    std::lock_guard<std::mutex> lk(mutex);
+                    lastRequest=req;
+                }
+                std::string resp=handler(req);
+                for (size_t at=0; at<resp.size(); ) {
+                    ssize_t put=write(conn, resp.data()+at, resp.size()-at);
+                    if (put<=0) break;
+                    at+=put;
+                }
+            }
+            close(conn);
+        }
+    }
+
+    static bool readRequest(int conn, Request &req) {
+        std::string in;
+        char buf[65536];
+        size_t end;
+        while ((end=in.find("\r\n\r\n"))==std::string::npos) {
+            ssize_t got=read(conn, buf, sizeof(buf));
+            if (got<=0) return false;
+            in.append(buf, got);
+        }
+        std::string head=in.substr(0, end+2);
+        req.body=in.substr(end+4);
+        size_t sp=head.find(' ');
+        req.method=head.substr(0, sp);
+        req.path=head.substr(sp+1, head.find(' ', sp+1)-sp-1);
+        int64_t length=0;
+        for (size_t at=head.find("\r\n")+2; at<head.size(); at=head.find("\r\n", at)+2) {
+            std::string line=head.substr(at, head.find("\r\n", at)-at);
+            if (line.compare(0, 16, "Content-Length: ")==0) length=atoll(line.c_str()+16);
+            if (line.compare(0, 14, "Content-Type: ")==0) req.contentType=line.substr(14);
+        }
+        while ((int64_t)req.body.size()<length) {
+            ssize_t got=read(conn, buf, std::min<int64_t>(sizeof(buf), length-req.body.size()));
+            if (got<=0) return false;
+            req.body.append(buf, got);
+        }
+        return true;
+    }
+};
+
+std::string response(int code, const std::string &body, const char *type="application/json") {
+    return "HTTP/1.1 "+std::to_string(code)+" X\r\nContent-Type: "+type+"\r\nContent-Length: "
+           +std::to_string(body.size())+"\r\n\r\n"+body;
+}
+
+//body sent in chunks of the given sizes, in turn
+std::string chunkedResponse(const std::string &body, const std::vector<size_t> &sizes) {
+    std::string out="HTTP/1.1 200 OK\r\nContent-Type: application/x-tar\r\nTransfer-Encoding: chunked\r\n\r\n";
+    char size[32];
+    for (size_t at=0, i=0; at<body.size(); i++) {
+        size_t n=std::min(sizes[i%sizes.size()], body.size()-at);
+        snprintf(size, sizeof(size), "%zx\r\n", n);
+        out+=size+body.substr(at, n)+"\r\n";
+        at+=n;
+    }
+    return out+"0\r\n\r\n";
+}
+
+//Bytes that are not all alike, so a misplaced piece shows
+std::string pattern(size_t n) {
+    std::string s(n, 0);
+    uint32_t x=12345;
+    for (auto &c:s) {
+        x=x*1103515245+12345;
+        c=(char)(x>>16);
+    }
+    return s;
+}
+
+//A file holding data, read back from its start
+int fileWith(const std::string &data) {
+    char name[]="/tmp/docker_client_test_file.XXXXXX";
+    int fd=mkstemp(name);
+    CHECK(fd>=0);
+    unlink(name);
+    CHECK(write(fd, data.data(), data.size())==(ssize_t)data.size() && lseek(fd, 0, SEEK_SET)==0);
+    return fd;
+}
+
+std::string fileContents(int fd) {
+    std::string out;
+    char buf[65536];
+    CHECK(lseek(fd, 0, SEEK_SET)==0);
+    ssize_t got;
+    while ((got=read(fd, buf, sizeof(buf)))>0) out.append(buf, got);
+    return out;
+}
+
+int main() {
+    FakeDaemon daemon;
+    DockerClient docker(daemon.socketPath);
+
+    //commit, paused by default and live on request
+    daemon.handler=[](const Request&) { return response(201, "{\"Id\":\"sha256:abc\"}"); };
+    CHECK(docker.commit("cid", "kv running", "3").ok());
+    Request req=daemon.last();
+    CHECK(req.method=="POST" && req.path=="/commit?container=cid&repo=kv%20running&tag=3");
+    CHECK(req.contentType=="application/json" && req.body=="{}");
+    CHECK(docker.commit("cid", "kv", "4", false).ok());
+    CHECK(daemon.last().path=="/commit?container=cid&repo=kv&tag=4&pause=0");
+
+    //save, sized and chunked, streamed into the file as it comes
+    std::string image=pattern(3*1024*1024+17);
+    daemon.handler=[&](const Request&) { return response(200, image, "application/x-tar"); };
+    int fd=fileWith("");
+    CHECK(docker.save("kv:3", fd).ok());
+    CHECK(daemon.last().method=="GET" && daemon.last().path=="/images/kv:3/get");
+    CHECK(fileContents(fd)==image);
+    close(fd);
+    daemon.handler=[&](const Request&) { return chunkedResponse(image, {1, 4096, 65536+3, 1000000}); };
+    fd=fileWith("");
+    CHECK(docker.save("kv:3", fd).ok());
+    CHECK(fileContents(fd)==image);
+    close(fd);
+
+    //A body cut short is a failure, not a short image
+    daemon.handler=[&](const Request&) {
+        return response(200, image, "application/x-tar").substr(0, 100000);
+    };
+    fd=fileWith("");
+    DockerStatus status=docker.save("kv:3", fd);
+    CHECK(!status.ok() && status.http==0 && status.message=="response cut short");
+    close(fd);
+    daemon.handler=[&](const Request&) { return chunkedResponse(image, {65536}).substr(0, 200000); };
+    fd=fileWith("");
+    CHECK(!docker.save("kv:3", fd).ok());
+    close(fd);
+
+    //load streams size bytes of the file, from where it stands, and reports the name
+    std::string tarball=pattern(2*1024*1024+5);
+    daemon.handler=[](const Request&) {
+        return chunkedResponse("{\"stream\":\"Loaded image: kv:7\\n\"}\r\n", {10});
+    };
+    fd=fileWith("skip"+tarball+"tail");
+    CHECK(lseek(fd, 4, SEEK_SET)==4);
+    std::string loaded;
+    CHECK(docker.load(fd, tarball.size(), &loaded).ok());
+    req=daemon.last();
+    CHECK(req.method=="POST" && req.path=="/images/load?quiet=1" && req.contentType=="application/x-tar");
+    CHECK(req.body==tarball);
+    CHECK(loaded=="kv:7");
+    close(fd);
+    daemon.handler=[](const Request&) {
+        return response(200, "{\"stream\":\"Loaded image ID: sha256:f00\\n\"}");
+    };
+    fd=fileWith("x");
+    CHECK(docker.load(fd, 1, &loaded).ok() && loaded=="sha256:f00");
+    close(fd);
+
+    //From a pipe, which sendfile does not take
+    int pipeFds[2];
+    CHECK(pipe(pipeFds)==0);
+    std::thread feeder([&]() {
+        for (size_t at=0; at<tarball.size(); at+=4096)
+            CHECK(write(pipeFds[1], tarball.data()+at, std::min<size_t>(4096, tarball.size()-at))>0);
+        close(pipeFds[1]);
+    });
+    CHECK(docker.load(pipeFds[0], tarball.size(), &loaded).ok());
+    feeder.join();
+    close(pipeFds[0]);
+    CHECK(daemon.last().body==tarball);
+
+    //A file shorter than announced ends the request instead of leaving the daemon waiting
+    fd=fileWith("short");
+    status=docker.load(fd, 1000, &loaded);
+    CHECK(!status.ok() && status.http==0);
+    close(fd);
+
+    //A load failing part way answers 200 with an error in the stream
+    daemon.handler=[](const Request&) { return response(200, "{\"error\":\"archive/tar: invalid tar header\"}"); };
+    fd=fileWith("x");
+    status=docker.load(fd, 1, &loaded);
+    CHECK(!status.ok() && status.http==500 && status.message=="archive/tar: invalid tar header");
+    close(fd);
+
+    //Failures carry the daemon's message, or the body when it is not JSON
+    daemon.handler=[](const Request&) { return response(404, "{\"message\":\"No such image: \\\"kv:9\\\"\"}"); };
+    status=docker.removeImage("kv:9");
+    CHECK(daemon.last().method=="DELETE" && daemon.last().path=="/images/kv:9");
+    CHECK(status.http==404 && status.message=="No such image: \"kv:9\"");
+    daemon.handler=[](const Request&) { return response(500, "daemon on fire", "text/plain"); };
+    status=docker.pause("kv-1");
+    CHECK(daemon.last().path=="/containers/kv-1/pause");
+    CHECK(status.http==500 && status.message=="daemon on fire");
+    daemon.handler=[](const Request&) { return std::string("garbage\r\n\r\n"); };
+    status=docker.start("kv-1");
+    CHECK(status.http==0 && !status.ok());
+
+    //204 has no body to wait for
+    daemon.handler=[](const Request&) { return std::string("HTTP/1.1 204 No Content\r\n\r\n"); };
+    CHECK(docker.unpause("kv-1").ok() && daemon.last().path=="/containers/kv-1/unpause");
+    CHECK(docker.rename("kv-1", "kv 1-twin").ok());
+    CHECK(daemon.last().method=="POST" && daemon.last().path=="/containers/kv-1/rename?name=kv%201-twin");
+    CHECK(docker.removeContainer("kv-1").ok());
+    CHECK(daemon.last().method=="DELETE" && daemon.last().path=="/containers/kv-1?force=1");
+    CHECK(docker.tag("sha256:f00", "kv", "ready").ok());
+    CHECK(daemon.last().path=="/images/sha256:f00/tag?repo=kv&tag=ready");
+    daemon.handler=[](const Request &r) {
+        return r.path=="/containers/kv-2/start"?std::string("HTTP/1.1 409 Conflict\r\nContent-Length: 0\r\n\r\n")
+                                              :response(201, "{\"Id\":\"c2\"}");
+    };
+    ContainerSpec spec;
+    spec.name="kv-2";
+    spec.image="kv:ready";
+    spec.cmd={"redis-server", "--port", "6379"};
+    spec.ports={{6379, 16379}};
+    spec.memMB=512;
+    status=docker.run(spec);
+    CHECK(status.http==409 && daemon.last().path=="/containers/kv-2/start");
+    CHECK(docker.create(spec).ok());
+    req=daemon.last();
+    CHECK(req.path=="/containers/create?name=kv-2");
+    CHECK(req.body=="{\"Image\":\"kv:ready\",\"Cmd\":[\"redis-server\",\"--port\",\"6379\"],\"ExposedPorts\":"
+                    "{\"6379/tcp\":{}},\"HostConfig\":{\"PortBindings\":{\"6379/tcp\":[{\"HostPort\":\"16379\"}]},"
+                    "\"Memory\":536870912}}");
+
+    //inspect: the top level Image, not Config's, and overlay2's UpperDir
+    daemon.handler=[](const Request&) {
+        return response(200, "{\"Id\":\"c1\",\"Image\":\"sha256:f00\",\"Config\":{\"Image\":\"kv:3\"},"
+                             "\"GraphDriver\":{\"Data\":{\"UpperDir\":\"/var/lib/docker/overlay2/x/diff\"}}}");
+    };
+    std::string imageID, upper;
+    CHECK(docker.inspectContainer("kv-1", &imageID, &upper).ok());
+    CHECK(daemon.last().method=="GET" && daemon.last().path=="/containers/kv-1/json");
+    CHECK(imageID=="sha256:f00" && upper=="/var/lib/docker/overlay2/x/diff");
+    CHECK(docker.inspectImage("kv:3").ok() && daemon.last().path=="/images/kv:3/json");
+
+    //No daemon there
+    DockerClient nowhere(daemon.socketPath+".gone");
+    status=nowhere.commit("cid", "kv", "1");
+    CHECK(status.http==0 && status.message.find("cannot connect to")==0);
+
+    CHECK((splitWords("redis-server --save '' \"a \\\"b\\\"\" c\\ d")
+           ==std::vector<std::string>{"redis-server", "--save", "", "a \"b\"", "c d"}));
+
+    std::cout<<"docker client tests passed\n";
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+// Shared by the tests and benchmarks: a recoverer run in a scratch directory of its own,
+// reached through a stub, and checks that end the run on failure.
+//
+
+#ifndef AUTORECOVERER_TESTS_HARNESS_H
+#define AUTORECOVERER_TESTS_HARNESS_H
+
+#include <grpcpp/grpcpp.h>
+#include "recover_service.grpc.pb.h"
+#include "recover_service.pb.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <csignal>
+#include <ftw.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            std::cerr<<__FILE__<<":"<<__LINE__<<": check failed: "<<#cond<<"\n";   \
+            exit(1);                                                                \
+        }                                                                           \
+    } while (0)
+
+//Exit status ctest counts as skipped (SKIP_RETURN_CODE)
+const int skipped=77;
+
+inline int removeEntry(const char *path, const struct stat*, int, struct FTW*) {
+    return remove(path);
+}
+
+//A port nothing listens on right now.
+inline int freePort() {
+    int fd=socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr={};
+    addr.sin_family=AF_INET;
+    addr.sin_addr.s_addr=htonl(INADDR_LOOPBACK);
+    socklen_t len=sizeof(addr);
+    CHECK(fd>=0 && bind(fd, (sockaddr*)&addr, len)==0 && getsockname(fd, (sockaddr*)&addr, &len)==0);
+    close(fd);
+    return ntohs(addr.sin_port);
+}
+
+//A recoverer started in a fresh directory with the given config, its output in
+//recoverer.log there. The test itself works in that directory too. Keep it in static
+//storage, so a failed CHECK, which exits, still stops it.
+class RecovererRun {
+public:
+    std::string dir;
+    std::unique_ptr<recoverer::recover_service::Stub> stub;
+
+    //Returns once the recoverer answers KeepAlive.
+    void start(const std::string &binary, const std::string &config) {
+        char name[]="recoverer_run.XXXXXX";
+        CHECK(mkdtemp(name)!=nullptr);
+        char *abs=realpath(name, nullptr);
+        dir=abs;
+        free(abs);
+        CHECK(chdir(dir.c_str())==0);
+        FILE *f=fopen("recoverer.conf", "w");
+        CHECK(f!=nullptr && fputs(config.c_str(), f)>=0 && fclose(f)==0);
+
+        std::string port=std::to_string(freePort());
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "recoverer.log", O_WRONLY|O_CREAT|O_TRUNC, 0644);
+        posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+        const char *args[]={binary.c_str(), port.c_str(), "recoverer.conf", nullptr};
+        CHECK(posix_spawn(&pid, binary.c_str(), &actions, nullptr, const_cast<char**>(args), environ)==0);
+        posix_spawn_file_actions_destroy(&actions);
+
+        grpc::ChannelArguments channelArgs;
+        channelArgs.SetMaxSendMessageSize(64*1024*1024);
+        stub=recoverer::recover_service::NewStub(
+            grpc::CreateCustomChannel("localhost:"+port, grpc::InsecureChannelCredentials(), channelArgs));
+        for (int tries=0; ; tries++) {
+            grpc::ClientContext cc;
+            cc.set_deadline(std::chrono::system_clock::now()+std::chrono::milliseconds(200));
+            recoverer::Reply rpl, rpl0;
+            if (stub->KeepAlive(&cc, rpl0, &rpl).ok() && rpl.status()==8) break;
+            CHECK(tries<100);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }
+
+    //Kills the recoverer and, unless keep is set, removes its directory.
+    void stop(bool keep=false) {
+        if (pid>0) {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+            pid=-1;
+        }
+        if (!dir.empty() && !keep) {
+            if (chdir("..")!=0) return;
+            nftw(dir.c_str(), removeEntry, 64, FTW_DEPTH|FTW_PHYS);
+            dir.clear();
+        }
+    }
+
+    ~RecovererRun() {
+        stop();
+    }
+
+private:
+    pid_t pid=-1;
+};
+
+//Polls GetVersion until imageN has version applied, for at most timeoutMs.
+inline bool waitApplied(recoverer::recover_service::Stub *stub, int imageN, int version, int timeoutMs) {
+    recoverer::Image img;
+    img.set_image(imageN);
+    auto deadline=std::chrono::steady_clock::now()+std::chrono::milliseconds(timeoutMs);
+    while (std::chrono::steady_clock::now()<deadline) {
+        grpc::ClientContext cc;
+        recoverer::VersionState vst;
+        if (stub->GetVersion(&cc, img, &vst).ok() && vst.applied()==version) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    return false;
+}
+
+#endif //AUTORECOVERER_TESTS_HARNESS_H
@@ -0,0 +1,125 @@
+//
+// Sends a full image larger than 4 GiB to a recoverer and checks every MiB of it landed
+// where it belongs, so sizes, chunk numbers and offsets stay 64-bit end to end. The
+// image is zeros but for a marker at the start of each MiB: its offset and chunk.
+//
+// large_image_test [recoverer binary]; LARGE_IMAGE_MIB sets the size (default 5 GiB
+// and a bit, so the last chunk is partial). Skipped when the disk has too little room.
+//
+
+#include "harness.h"
+#include <vector>
+#include <zlib.h>
+#include <sys/statvfs.h>
+
+using namespace recoverer;
+
+const int64_t chunkSize=16*1024*1024;
+const int64_t markEvery=1024*1024;
+RecovererRun run;
+
+void mark(char *data, int64_t offset, int64_t len) {
+    for (int64_t at=0; at<len; at+=markEvery) {
+        int64_t m[2]={offset+at, (offset+at)/chunkSize};
+        memcpy(data+at, m, std::min<int64_t>(sizeof(m), len-at));
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc!=2) {
+        std::cout<<"large_image_test [recoverer binary]\n";
+        return 1;
+    }
+    const char *mib=getenv("LARGE_IMAGE_MIB");
+    int64_t size=mib!=nullptr?atoll(mib)*1024*1024+4321:5LL*1024*1024*1024+4321;
+    struct statvfs fs;
+    if (statvfs(".", &fs)!=0 || (int64_t)(fs.f_bavail*fs.f_frsize)<size+size/10) {
+        std::cout<<"Not enough room for a "<<size<<" byte image here, skipping\n";
+        return skipped;
+    }
+    //Nothing to load the image into; the preload after it is applied just fails.
+    //LARGE_IMAGE_CONFIG adds config lines, e.g. "cache direct" or "layout log".
+    const char *extra=getenv("LARGE_IMAGE_CONFIG");
+    run.start(argv[1], "docker /nonexistent/docker.sock\n"+std::string(extra!=nullptr?extra:"")+"\n");
+
+    Version vs;
+    vs.set_image(1);
+    vs.set_version(0);
+    vs.set_size(size);
+    vs.set_chunk_size(chunkSize);
+    vs.set_full(true);
+    vs.set_base(-1);
+    Reply rpl;
+    {
+        grpc::ClientContext cc;
+        CHECK(run.stub->TellVersion(&cc, vs, &rpl).ok() && rpl.status()==8);
+    }
+    int64_t chunkN=(size+chunkSize-1)/chunkSize;
+    Image img;
+    img.set_image(1);
+    ChunkList ckl;
+    {
+        grpc::ClientContext cc;
+        CHECK(run.stub->Chunk2Send(&cc, img, &ckl).ok());
+    }
+    CHECK(ckl.missing_size()==1 && ckl.missing(0).first()==0 && ckl.missing(0).count()==chunkN);
+
+    //Most chunks go as they are, some deflated, all with their crc32
+    auto start=std::chrono::steady_clock::now();
+    std::vector<char> plain(chunkSize, 0);
+    std::vector<char> packed(compressBound(chunkSize));
+    for (int64_t c=0; c<chunkN; c++) {
+        int64_t len=std::min(chunkSize, size-c*chunkSize);
+        mark(plain.data(), c*chunkSize, len);
+        Chunk ck;
+        ck.set_image(1);
+        ck.set_version(0);
+        ck.set_number(c);
+        ck.set_checksum((int32_t)crc32(crc32(0L, Z_NULL, 0), (const Bytef*)plain.data(), len));
+        if (c%64==63 || c==chunkN-1) {
+            z_stream zs{};
+            CHECK(deflateInit2(&zs, 1, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY)==Z_OK);
+            zs.next_in=(Bytef*)plain.data();
+            zs.avail_in=len;
+            zs.next_out=(Bytef*)packed.data();
+            zs.avail_out=packed.size();
+            CHECK(deflate(&zs, Z_FINISH)==Z_STREAM_END);
+            ck.set_data(packed.data(), zs.total_out);
+            ck.set_compressed(true);
+            deflateEnd(&zs);
+        }
+        else ck.set_data(plain.data(), len);
+        grpc::ClientContext cc;
+        CHECK(run.stub->SendChunk(&cc, ck, &rpl).ok() && rpl.status()==8);
+        //A chunk already received is refused
+        if (c==chunkN/2) {
+            grpc::ClientContext cc2;
+            CHECK(run.stub->SendChunk(&cc2, ck, &rpl).ok() && rpl.status()==9);
+        }
+    }
+    CHECK(waitApplied(run.stub.get(), 1, 0, 600*1000));
+    double seconds=std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+    std::cout<<"Sent and applied "<<size<<" bytes in "<<chunkN<<" chunks: "<<seconds<<"s\n";
+    {
+        grpc::ClientContext cc;
+        CHECK(run.stub->Chunk2Send(&cc, img, &ckl).ok() && ckl.missing_size()==0);
+    }
+
+    int fd=open("img_1_0", O_RDONLY);
+    CHECK(fd>=0);
+    struct stat st;
+    CHECK(fstat(fd, &st)==0 && st.st_size==size);
+    for (int64_t at=0; at<size; at+=markEvery) {
+        int64_t m[2]={0, 0}, want[2]={at, at/chunkSize};
+        int64_t n=std::min<int64_t>(sizeof(m), size-at);
+        CHECK(pread(fd, m, n, at)==n && memcmp(m, want, n)==0);
+    }
+    //And zeros between the markers, past 4 GiB too
+    for (int64_t at : {(int64_t)4096, size/2+4096, size-1}) {
+        char b=1;
+        CHECK(pread(fd, &b, 1, at)==1 && b==0);
+    }
+    close(fd);
+    std::cout<<"Every MiB of Image#1, Version#0 is in place\n";
+    return 0;
+}